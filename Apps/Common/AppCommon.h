@@ -90,6 +90,8 @@ namespace SIM
     writer->registerWriter(hdf);
     simulator.registerFields(*writer);
     IFEM::registerCallback(*writer);
+    if (IFEM::getOptions().hdf5Async > 0)
+      writer->setAsync(IFEM::getOptions().hdf5Async);
     return writer;
   }
 }
@@ -0,0 +1,107 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SIMParareal.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Parallel-in-time (Parareal) driver for multi-step solvers.
+//!
+//==============================================================================
+
+#ifndef _SIM_PARAREAL_H_
+#define _SIM_PARAREAL_H_
+
+#include "SIMinput.h"
+#include "MatVec.h"
+
+class MultiStepSIM;
+class TimeStep;
+
+
+/*!
+  \brief Parallel-in-time solution driver based on the Parareal algorithm.
+  \details This driver wraps a coarse and one or more fine multi-step solution
+  drivers operating on the same FE discretization. The time domain is split
+  into a number of slices. The coarse propagator (a larger time step size
+  and/or fewer Gauss points) is run sequentially over all slices, whereas the
+  fine propagations of the individual slices are run concurrently, using one
+  fine solver per thread and/or distributing the slices over the MPI ranks.
+  The coarse predictions are then corrected by the fine solutions until the
+  slice boundary states converge.
+
+  Each fine solver must have its own FE model instance. When running with
+  MPI, the fine models must be serial in space, i.e., each rank must hold
+  the complete model.
+*/
+
+class SIMParareal : public SIMinput
+{
+public:
+  //! \brief The constructor initializes the references to the solvers.
+  //! \param coarse The coarse propagator
+  //! \param fine The fine propagators, one for each concurrent thread
+  SIMParareal(MultiStepSIM& coarse, const std::vector<MultiStepSIM*>& fine);
+  //! \brief Empty destructor.
+  virtual ~SIMParareal() {}
+
+  //! \brief Solves the problem over the time domain defined by \a tp.
+  //! \param[in] tp Time stepping parameters of the fine solution
+  //! \return 0 on success, otherwise a positive error code
+  //!
+  //! \details The initial state is taken from the coarse solver, and the
+  //! final state is available through getSolutions() on return.
+  int solveProblem(const TimeStep& tp);
+
+  //! \brief Returns the solution state at the end of the time domain.
+  const Vectors& getSolutions() const { return U.back(); }
+
+protected:
+  using SIMinput::parse;
+  //! \brief Parses a data section from an XML element.
+  virtual bool parse(const TiXmlElement* elem);
+
+  //! \brief Propagates a solution state over a time interval.
+  //! \param solver The solution driver to use for the propagation
+  //! \param state The solution state to propagate
+  //! \param[in] t0 Start time of the interval
+  //! \param[in] t1 End time of the interval
+  //! \param[in] dt Time step size to use
+  //! \param[in] firstStep If \e true, this is the first step of the simulation
+  bool propagate(MultiStepSIM& solver, Vectors& state,
+                 double t0, double t1, double dt, bool firstStep) const;
+
+  //! \brief Runs the fine propagators over the time slices [\a n0, nSlices>.
+  //! \param[in] n0 Index of the first unconverged time slice
+  //! \param[out] sumTime Wall time spent on all the slices in total
+  bool fineSweep(int n0, double& sumTime);
+
+  //! \brief Exchanges the fine solution of slice \a n from its owning rank.
+  void exchange(int n);
+
+private:
+  MultiStepSIM&              S0; //!< The coarse propagator
+  std::vector<MultiStepSIM*> S1; //!< The fine propagators
+
+  int    nSlices;  //!< Number of time slices
+  int    maxIt;    //!< Maximum number of Parareal iterations
+  double tol;      //!< Relative convergence tolerance on the slice states
+  double dtCoarse; //!< Time step size of the coarse propagator
+  double dtFine;   //!< Time step size of the fine propagators
+  int    nGauss;   //!< Number of Gauss points for the coarse propagator
+  bool   refSol;   //!< If \e true, compute the sequential fine solution too
+
+  int myRank; //!< Rank of this process in the time-parallel communicator
+  int nRanks; //!< Number of processes in the time-parallel communicator
+
+  std::vector<double>  T; //!< Time slice boundaries
+  std::vector<Vectors> U; //!< Current solution state at each slice boundary
+  std::vector<Vectors> G; //!< Coarse solution state at each slice boundary
+  std::vector<Vectors> F; //!< Fine solution state at each slice boundary
+
+  double fineTime; //!< Wall time of the fine propagations of the last solve
+};
+
+#endif
@@ -17,7 +17,10 @@
 #include "SIMinput.h"
 #include "DataExporter.h"
 #include "TimeStep.h"
+#include "SolverMonitor.h"
 #include "IFEM.h"
+#include "Profiler.h"
+#include "Telemetry.h"
 #include "tinyxml.h"
 
 
@@ -53,9 +56,13 @@ template<class T1> class SIMSolver : public SIMinput
 {
 public:
   //! \brief The constructor initializes the reference to the actual solver.
-  SIMSolver(T1& s1) : SIMinput("Time integration driver"), S1(s1) {}
-  //! \brief Empty destructor.
-  virtual ~SIMSolver() {}
+  //! \details It also registers the progress monitor with the control fifo.
+  SIMSolver(T1& s1) : SIMinput("Time integration driver"), S1(s1)
+  {
+    IFEM::registerCallback(monitor);
+  }
+  //! \brief The destructor unregisters the progress monitor.
+  virtual ~SIMSolver() { IFEM::unregisterCallback(monitor); }
 
   //! \brief Returns a const reference to the time stepping information.
   const TimeStep& getTimePrm() const { return tp; }
@@ -79,15 +86,22 @@ public:
       return 2;
 
     this->printHeading(heading);
+    monitor.setExporter(exporter);
 
     // Solve for each time step up to final time
     for (int iStep = 1; this->advanceStep(); iStep++)
+    {
+      double tStart = Telemetry::now();
       if (!S1.solveStep(tp))
         return 3;
       else if (!this->saveState(exporter,geoBlk,nBlock))
         return 4;
-      else
-        IFEM::pollControllerFifo();
+
+      double wallTime = Telemetry::now()-tStart;
+      monitor.addStep(tp,wallTime);
+      this->recordStep(wallTime);
+      IFEM::pollControllerFifo();
+    }
 
     return 0;
   }
@@ -117,6 +131,8 @@ protected:
                  bool newMesh = false, char* infile = nullptr,
                  bool saveRes = true)
   {
+    Telemetry::Scope timer(Telemetry::OUTPUT);
+
     if (newMesh && !S1.saveModel(infile,geoBlk,nBlock))
       return false;
 
@@ -129,8 +145,29 @@ protected:
     return true;
   }
 
-  TimeStep tp; //!< Time stepping information
-  T1&      S1; //!< The actual solver
+  //! \brief Writes a telemetry record for the current time step.
+  //! \param[in] wallTime Wall time spent on this step, including output
+  //!
+  //! \details The linear solver iterations reported are those not already
+  //! reported by the iteration records of a nonlinear solution procedure.
+  void recordStep(double wallTime) const
+  {
+    if (!Telemetry::enabled()) return;
+
+    Telemetry::Record("step").add("step",tp.step).add("time",tp.time.t)
+      .add("dt",tp.time.dt).add("iterations",tp.iter)
+      .add("linear_its",Telemetry::takeLinearIterations())
+      .add("assembly",Telemetry::takeTime(Telemetry::ASSEMBLY))
+      .add("solve",Telemetry::takeTime(Telemetry::SOLVE))
+      .add("output",Telemetry::takeTime(Telemetry::OUTPUT))
+      .add("step_wall",wallTime)
+      .add("rss_mb",utl::getResidentSize()/1048576.0);
+    Telemetry::flush();
+  }
+
+  TimeStep      tp;      //!< Time stepping information
+  T1&           S1;      //!< The actual solver
+  SolverMonitor monitor; //!< Answers progress queries over the control fifo
 };
 
 #endif
@@ -20,11 +20,21 @@
 
 /*!
   \brief Basic VTU file writer class.
+
+  \details The data arrays are written either as ASCII text, or as raw or
+  zlib-compressed binary data in an appended data block. Optionally, each
+  patch is written to a separate piece file, collected in a .pvtu file.
+  When writing several time steps, a .pvd file collecting them is also written.
 */
 
 class VTU : public VTF {
   public:
-    VTU(const char* base, bool single);
+    //! \brief The constructor initializes the VTU file name and format.
+    //! \param[in] base The base name of the VTU file(s)
+    //! \param[in] single If \e true, write a single time step only
+    //! \param[in] format Data format (0 = ASCII, 1 = binary, 2 = zlib)
+    //! \param[in] pieces If \e true, write each patch to a separate file
+    VTU(const char* base, bool single, int format = 0, bool pieces = false);
     virtual ~VTU();
 
     void clearGeometryBlocks();
@@ -64,6 +74,17 @@ class VTU : public VTF {
                       int idBlock = 1, const char* resultName = 0,
                       int iStep = 0, int iBlock = 1);
   protected:
+    //! \brief Writes a VTU file with the given patches.
+    //! \param[in] fileName Name of the VTU file
+    //! \param[in] patches Indices of the patches to write
+    bool writeFile(const std::string& fileName,
+                   const std::vector<size_t>& patches) const;
+    //! \brief Writes a .pvtu file collecting the given piece files.
+    bool writePVTU(const std::string& fileName,
+                   const std::vector<std::string>& pieces) const;
+    //! \brief Writes a .pvd file collecting all time steps written so far.
+    bool writePVD() const;
+
     std::string m_base;
     std::vector<const ElementBlock*> m_geom;
     struct FieldInfo {
@@ -75,4 +96,9 @@ class VTU : public VTF {
     };
     std::map<int,FieldInfo> m_field;
     bool m_single;
+    int  m_format; //!< Data format (0 = ASCII, 1 = binary, 2 = zlib)
+    bool m_pieces; //!< If \e true, write each patch to a separate file
+
+    //! Time step values and file names for the .pvd file
+    std::vector< std::pair<Real,std::string> > m_steps;
 };
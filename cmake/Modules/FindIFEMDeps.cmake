@@ -73,6 +73,10 @@ SET(IFEM_DEPINCLUDES ${IFEM_DEPINCLUDES}
                      ${GoTools_INCLUDE_DIRS}
                      ${GoTrivariate_INCLUDE_DIRS})
 
+# Threads, for the asynchronous result output
+FIND_PACKAGE(Threads REQUIRED)
+SET(IFEM_DEPLIBS ${IFEM_DEPLIBS} ${CMAKE_THREAD_LIBS_INIT})
+
 SET(IFEM_CXX_FLAGS "${IFEM_CXX_FLAGS} ${CMAKE_CXX_FLAGS} ${CXX_STD11_FLAGS}")
 SET(IFEM_BUILD_CXX_FLAGS "${IFEM_BUILD_CXX_FLAGS} ${CMAKE_CXX_FLAGS} ${CXX_STD11_FLAGS}")
 
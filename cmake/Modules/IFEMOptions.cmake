@@ -14,3 +14,4 @@ OPTION(IFEM_USE_UMFPACK        "Compile with UMFPACK support?"        ON)
 OPTION(IFEM_AS_SUBMODULE       "Compile IFEM as a submodule of apps?" OFF)
 OPTION(IFEM_WHOLE_PROG_OPTIM   "Compile IFEM with link-time optimizations?" OFF)
 OPTION(IFEM_TEST_MEMCHECK      "Run tests through valgrind?"          OFF)
+OPTION(IFEM_TEST_PERFORMANCE   "Add performance regression tests?"    OFF)
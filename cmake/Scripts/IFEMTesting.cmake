@@ -56,6 +56,11 @@ macro(IFEM_add_unittests IFEM_PATH)
     list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/LinAlg/Test/TestISTLPETScMatrix.C)
   endif()
 
+  if(NOT HDF5_FOUND)
+    list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/Utility/Test/TestHDF5Writer.C)
+    list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/Utility/Test/TestFieldFunctions.C)
+  endif()
+
   if(NOT ISTL_FOUND)
     list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/LinAlg/Test/TestISTLMatrix.C)
     list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/LinAlg/Test/TestISTLPETScMatrix.C)
@@ -80,6 +85,9 @@ macro(IFEM_add_unittests IFEM_PATH)
     if(ISTL_FOUND)
       list(APPEND TEST_SRCS_MPI ${IFEM_PATH}/src/LinAlg/Test/MPI/TestISTLMatrix.C)
     endif()
+    if(HDF5_FOUND)
+      list(APPEND TEST_SRCS_MPI ${IFEM_PATH}/src/Utility/Test/MPI/TestHDF5Writer.C)
+    endif()
     add_executable(IFEM-MPI-test EXCLUDE_FROM_ALL
                    ${IFEM_PATH}/src/IFEM-test.C ${TEST_SRCS_MPI})
     target_link_libraries(IFEM-MPI-test ${IFEM_LIBRARIES} ${IFEM_DEPLIBS} gtest)
@@ -103,6 +111,45 @@ function(IFEM_add_test name binary)
   endif(IFEM_TEST_MEMCHECK)
 endfunction()
 
+# Performance regression test, comparing the profiling report of a
+# regression test case against the baseline in the corresponding .perf file.
+# The tests are labelled performance, run them with ctest -L performance.
+function(IFEM_add_perf_test name binary)
+  if(NOT IFEM_TEST_PERFORMANCE)
+    return()
+  endif()
+  if(IFEM_TEST_EXTRA)
+    set(test-name "perf+${binary}+${IFEM_TEST_EXTRA}+${name}")
+  else()
+    set(test-name "perf+${binary}+${name}")
+  endif()
+  add_test("${test-name}" regtest.sh -perf ${EXECUTABLE_OUTPUT_PATH}/${binary} ${PROJECT_SOURCE_DIR}/${TEST_SUBDIR}/Test/${name} ${ARGN})
+  set_tests_properties("${test-name}" PROPERTIES LABELS performance
+                                                 RUN_SERIAL TRUE)
+endfunction()
+
+# Micro-benchmarks of the computational kernels.
+# The benchmarks target runs them and writes the results to benchmarks.json.
+# The executable is built with all, and the check target runs a quick pass
+# of every case such that the benchmarks do not silently break.
+macro(IFEM_add_benchmarks IFEM_PATH)
+  file(GLOB BENCH_SOURCES ${IFEM_PATH}/src/Benchmarks/*.C)
+  add_executable(IFEM-bench ${IFEM_PATH}/src/IFEM-bench.C ${BENCH_SOURCES})
+  target_include_directories(IFEM-bench PRIVATE ${IFEM_PATH}/src/Benchmarks)
+  target_link_libraries(IFEM-bench ${IFEM_LIBRARIES} ${IFEM_DEPLIBS})
+  add_test(NAME IFEM-bench-quick
+           COMMAND IFEM-bench --quick --min-time 0
+           WORKING_DIRECTORY ${PROJECT_BINARY_DIR})
+  if(TARGET check)
+    add_dependencies(check IFEM-bench)
+  endif()
+  add_custom_target(benchmarks
+                    COMMAND IFEM-bench --json ${CMAKE_BINARY_DIR}/benchmarks.json
+                    DEPENDS IFEM-bench
+                    WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+                    COMMENT "Running micro-benchmarks" VERBATIM)
+endmacro()
+
 macro(add_check_target)
   add_custom_target(check ${CMAKE_CTEST_COMMAND} WORKING_DIRECTORY ${PROJECT_BINARY_DIR})
   add_custom_command(TARGET check PRE_BUILD COMMAND ${CMAKE_COMMAND} -E remove ${CMAKE_BINARY_DIR}/failed.log)
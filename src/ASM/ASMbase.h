@@ -17,8 +17,10 @@
 #include "MatVec.h"
 #include "MPCLess.h"
 #include "Function.h"
+#include "Profiler.h"
 #include <map>
 #include <set>
+#include <memory>
 
 typedef std::vector<int>       IntVec;  //!< General integer vector
 typedef std::vector<IntVec>    IntMat;  //!< General 2D integer matrix
@@ -29,6 +31,7 @@ typedef MPCSet::const_iterator MPCIter; //!< Iterator over an MPC equation set
 struct TimeDomain;
 class ElementBlock;
 class Field;
+class FiniteElement;
 class GlobalIntegral;
 class IntegrandBase;
 class Integrand;
@@ -108,6 +111,10 @@ public:
   virtual bool read(std::istream& is) = 0;
   //! \brief Writes the geometry/basis of the patch to the given stream.
   virtual bool write(std::ostream& os, int basis = 0) const = 0;
+  //! \brief Writes the patch geometry as a binary record to the given stream.
+  //! \details The binary record is recognized by the read() method of the
+  //! structured spline patches, and is used for caching of large models.
+  virtual bool writeBinary(std::ostream&) const { return false; }
 
   //! \brief Adds a circular immersed boundary in the physical geometry.
   virtual void addHole(double, double, double) {}
@@ -651,6 +658,57 @@ protected:
   //! is changed into the number of the other node.
   static bool collapseNodes(ASMbase& pch1, int node1, ASMbase& pch2, int node2);
 
+protected:
+  //! \brief Basis function values at a regular grid of visualization points.
+  //! \details The derivatives depend on the geometry, and are only computed
+  //! when secondary solutions are evaluated on the grid.
+  struct VizBasis
+  {
+    std::vector<RealArray> par; //!< Parameter values of the grid points
+    size_t    nBasis; //!< Number of basis functions of the patch
+    size_t    nen;    //!< Number of nonzero basis functions in each point
+    IntVec    ip;     //!< 0-based indices of the nonzero basis functions
+    RealArray N;      //!< Values of the nonzero basis functions
+    RealArray dNdX;   //!< Cartesian derivatives of the nonzero basis functions
+    RealArray detJ;   //!< Jacobian determinant in each point
+    RealArray X;      //!< Cartesian coordinates of each point
+
+    mutable utl::MemAccount mem; //!< Memory owned by the cached values
+
+    //! \brief Default constructor.
+    VizBasis() : nBasis(0), nen(0), mem("Basis cache") {}
+  };
+
+  //! \brief Returns cached basis function values for a grid of points.
+  //! \param[in] gpar Parameter values of the grid, in each direction
+  //! \param[in] nBasis Number of basis functions of the patch
+  //! \return The cached values, or an empty pointer if not cached
+  std::shared_ptr<const VizBasis> getVizBasis(const RealArray* gpar,
+                                              size_t nBasis) const;
+  //! \brief Caches basis function values for a grid of points.
+  //! \details Pass an empty pointer to invalidate the cache, e.g., when the
+  //! patch is refined or its control point coordinates are updated.
+  void setVizBasis(const std::shared_ptr<const VizBasis>& basis) const;
+  //! \brief Adds basis function values and derivatives of a grid point.
+  //! \param basis The grid point cache to append to
+  //! \param[in] ip 0-based indices of the nonzero basis functions
+  //! \param[in] fe Basis function values and derivatives in the point
+  //! \param[in] X Cartesian coordinates of the point
+  static void addVizPoint(VizBasis& basis, const IntVec& ip,
+                          const FiniteElement& fe, const Vector& X);
+  //! \brief Evaluates a field at the points of a cached grid.
+  //! \param[out] sField Field values at each point
+  //! \param[in] locSol Field coefficients local to current patch
+  //! \param[in] basis Basis function values at the points
+  static void evalVizField(Matrix& sField, const Vector& locSol,
+                           const VizBasis& basis);
+  //! \brief Evaluates a secondary solution field at the points of a cached grid.
+  //! \param[out] sField Solution field values at each point
+  //! \param[in] integrand Object with problem-specific data and methods
+  //! \param[in] basis Basis function values and derivatives at the points
+  bool evalVizSolution(Matrix& sField, const IntegrandBase& integrand,
+                       const VizBasis& basis) const;
+
 public:
   static bool fixHomogeneousDirichlet; //!< If \e true, pre-eliminate fixed DOFs
 
@@ -693,6 +751,9 @@ protected:
 private:
   std::pair<size_t,size_t> myLMs; //!< Nodal range of the Lagrange multipliers
   std::vector<char>    myLMTypes; //!< Type of Lagrange multiplier ('L' or 'G')
+
+  //! Basis function values at the last evaluated visualization grid
+  mutable std::shared_ptr<const VizBasis> vizBasis;
 };
 
 #endif
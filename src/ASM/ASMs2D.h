@@ -127,6 +127,8 @@ public:
   virtual bool read(std::istream&);
   //! \brief Writes the geometry of the SplineSurface object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
+  //! \brief Writes the geometry of the SplineSurface object as a binary record.
+  virtual bool writeBinary(std::ostream& os) const;
 
   //! \brief Generates the finite element topology data for the patch.
   //! \details The data generated are the element-to-node connectivity array,
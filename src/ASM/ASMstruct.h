@@ -76,6 +76,34 @@ protected:
   //! of the dimension-specific sub-classes.
   bool addXNodes(unsigned short int dim, size_t nXn, IntVec& nodes);
 
+  //! \brief Raw spline data of a binary patch record.
+  //! \details A binary patch record consists of a fixed-size 64-byte header
+  //! followed by the knot vectors and the control point coefficients as
+  //! contiguous native doubles, such that it may be memory-mapped directly.
+  struct SplineData
+  {
+    int  classType;     //!< GoTools class type (100, 200 or 700)
+    int  dim;           //!< Spatial dimension of the control points
+    bool rational;      //!< If \e true, the coefficients include the weights
+    int  n[3];          //!< Number of coefficients in each parameter direction
+    int  p[3];          //!< Spline order in each parameter direction
+    RealArray knots[3]; //!< Knot vectors in each parameter direction
+    RealArray coefs;    //!< Control point coefficients
+  };
+
+  //! \brief Checks if the given stream is positioned at a binary patch record.
+  static bool isBinary(std::istream& is);
+  //! \brief Reads a binary patch record from the given stream.
+  //! \param is The input stream to read from
+  //! \param[out] spline The spline data read
+  static bool readSplineData(std::istream& is, SplineData& spline);
+  //! \brief Writes a binary patch record to the given stream.
+  //! \param os The output stream to write to
+  //! \param[in] spline The spline data to write
+  //! \param[in] ndir Number of parameter directions
+  static bool writeSplineData(std::ostream& os, const SplineData& spline,
+                              int ndir);
+
 protected:
   Go::GeomObject* geo; //!< Pointer to the actual spline geometry object
 
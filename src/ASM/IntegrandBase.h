@@ -190,6 +190,14 @@ public:
 
   //! \brief Returns an evaluated principal direction vector field for plotting.
   virtual bool getPrincipalDir(Matrix&, size_t, size_t) const { return false; }
+  //! \brief Returns whether the secondary solution can be evaluated in parallel.
+  //! \details Reimplement this method to return \e true in integrands where
+  //! evalSol does not update any internal result buffers, such that it can be
+  //! invoked concurrently for different result points.
+  //! The default is \e false, since the application integrands often use
+  //! mutable work arrays in evalSol. The integrands of this library do not
+  //! implement evalSol, so the applications must enable it themselves.
+  virtual bool parallelEvalSol() const { return false; }
 
 
   // Various service methods
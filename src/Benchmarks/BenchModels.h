@@ -0,0 +1,113 @@
+// $Id$
+//==============================================================================
+//!
+//! \file BenchModels.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Model problems used by the micro-benchmarks.
+//!
+//==============================================================================
+
+#ifndef _BENCH_MODELS_H
+#define _BENCH_MODELS_H
+
+#include "IntegrandBase.h"
+#include "AlgEqSystem.h"
+#include "SIM2D.h"
+#include "SIM3D.h"
+
+
+namespace bench
+{
+  /*!
+    \brief Integrand for the Laplace operator with a unit source term.
+  */
+
+  class Laplace : public IntegrandBase
+  {
+  public:
+    //! \brief The constructor sets the number of space dimensions.
+    Laplace(unsigned short int n) : IntegrandBase(n) {}
+    //! \brief Empty destructor.
+    virtual ~Laplace() {}
+
+    using IntegrandBase::evalInt;
+    //! \brief Evaluates the integrand at an interior point.
+    virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
+                         const Vec3& X) const;
+  };
+
+  /*!
+    \brief Integrand for linear isotropic elasticity with a unit body force.
+  */
+
+  class Elasticity : public IntegrandBase
+  {
+  public:
+    //! \brief The constructor sets the number of space dimensions.
+    Elasticity(unsigned short int n);
+    //! \brief Empty destructor.
+    virtual ~Elasticity() {}
+
+    using IntegrandBase::evalInt;
+    //! \brief Evaluates the integrand at an interior point.
+    virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
+                         const Vec3& X) const;
+
+  private:
+    double lambda; //!< First Lame parameter
+    double mu;     //!< Shear modulus
+  };
+
+  //! \brief Refines a unit square or cube patch.
+  //! \param pch The patch to refine
+  //! \param[in] p Polynomial degree of the refined patch
+  //! \param[in] n Number of elements in each parameter direction
+  bool refine(ASMbase* pch, int p, int n);
+
+  /*!
+    \brief Simulator for the benchmark model problems.
+    \details The model is the unit square or cube discretized by \a n elements
+    of degree \a p in each direction, without any boundary conditions.
+  */
+
+  template<class Dim> class Model : public Dim
+  {
+  public:
+    //! \brief The constructor initializes the integrand to use.
+    //! \param[in] elasticity If \e true, solve the elasticity problem,
+    //! otherwise the Laplace problem
+    Model(bool elasticity) : Dim(elasticity ? (IntegrandBase*)
+                               new Elasticity(Dim::dimension) :
+                               (IntegrandBase*)new Laplace(Dim::dimension),
+                               elasticity ? Dim::dimension : 1) {}
+    //! \brief Empty destructor.
+    virtual ~Model() {}
+
+    //! \brief Creates the refined model and allocates the equation system.
+    //! \param[in] p Polynomial degree
+    //! \param[in] n Number of elements in each parameter direction
+    //! \param[in] mType The linear equation system matrix type to use
+    bool setup(int p, int n, int mType)
+    {
+      this->opt.solver = mType;
+      this->opt.nGauss[0] = p+1;
+      if (!this->createDefaultModel() || !refine(this->getPatch(1),p,n))
+        return false;
+
+      return this->preprocess() && this->initSystem(mType) &&
+             this->setMode(::SIM::STATIC);
+    }
+
+    //! \brief Returns the system coefficient matrix.
+    SystemMatrix* getMatrix() const
+    {
+      return this->myEqSys ? this->myEqSys->getMatrix(0) : nullptr;
+    }
+  };
+}
+
+#endif
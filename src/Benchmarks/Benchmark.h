@@ -0,0 +1,126 @@
+// $Id$
+//==============================================================================
+//!
+//! \file Benchmark.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Simple micro-benchmark harness for the computational kernels.
+//!
+//==============================================================================
+
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+
+
+namespace bench
+{
+  //! \brief Named parameters identifying a benchmark case.
+  typedef std::vector< std::pair<std::string,double> > Params;
+
+  /*!
+    \brief Timing results of a benchmark case.
+  */
+
+  struct Result
+  {
+    std::string name;    //!< Full name of the benchmark case
+    Params      params;  //!< Parameters of the benchmark case
+    size_t      nRep;    //!< Number of timed repetitions
+    double      tMin;    //!< Minimum time per repetition (seconds)
+    double      tMedian; //!< Median time per repetition (seconds)
+    double      tMean;   //!< Mean time per repetition (seconds)
+    double      items;   //!< Number of work items per repetition
+    std::string unit;    //!< Name of the work items
+    double      flops;   //!< Floating-point operations per repetition
+  };
+
+  /*!
+    \brief Class for running and recording benchmark cases.
+    \details Each case is executed once untimed (for warm-up), and is then
+    repeated until the accumulated time exceeds a given minimum time, with a
+    minimum of three repetitions. The minimum, median and mean times are
+    recorded, together with the derived throughputs.
+  */
+
+  class Runner
+  {
+  public:
+    //! \brief Default constructor.
+    Runner() : minTime(0.2), quickRun(false), nFailed(0) {}
+
+    //! \brief Parses the command-line options.
+    //! \return \e false if the program should terminate
+    bool parse(int argc, char** argv);
+
+    //! \brief Returns \e true if the reduced set of cases should be run.
+    bool quick() const { return quickRun; }
+    //! \brief Checks if the named benchmark case is selected for execution.
+    bool selected(const std::string& name) const;
+
+    //! \brief Runs a benchmark case and records its timings.
+    //! \param[in] name Full name of the benchmark case
+    //! \param[in] params Parameters of the benchmark case
+    //! \param[in] fn The function to time, returning \e false on failure
+    //! \param[in] items Number of work items processed per invocation
+    //! \param[in] unit Name of the work items (e.g. "elements")
+    //! \param[in] flops Floating-point operations per invocation, if known
+    bool run(const std::string& name, const Params& params,
+             const std::function<bool()>& fn,
+             double items, const char* unit, double flops = 0.0);
+
+    //! \brief Records a benchmark case that failed to set up or run.
+    void addFailure() { ++nFailed; }
+    //! \brief Returns the number of failed benchmark cases.
+    size_t failures() const { return nFailed; }
+
+    //! \brief Prints a summary of the recorded results.
+    void printSummary(std::ostream& os) const;
+    //! \brief Writes the recorded results to the JSON-file, if requested.
+    bool writeJSON() const;
+
+  private:
+    std::vector<Result> results; //!< The recorded benchmark results
+
+    std::vector<std::string> filters; //!< Selection of cases to run
+    std::string jsonFile; //!< Name of the JSON output file
+    double      minTime;  //!< Minimum accumulated time per case (seconds)
+    bool        quickRun; //!< If \e true, run a reduced set of cases
+    size_t      nFailed;  //!< Number of failed benchmark cases
+  };
+
+  //! \brief Signature of a benchmark function.
+  typedef void (*Function)(Runner&);
+
+  //! \brief Registers a benchmark function.
+  //! \return Always \e true, such that it can initialize a static variable
+  bool add(const char* name, Function fn);
+  //! \brief Runs all registered benchmark functions.
+  void runAll(Runner& runner);
+
+  //! \brief Returns the full name of a benchmark case.
+  //! \param[in] prefix Name of the benchmarked kernel
+  //! \param[in] params Parameters of the benchmark case
+  std::string caseName(const std::string& prefix, const Params& params);
+  //! \brief Returns the thread counts to run the threaded kernels with.
+  std::vector<int> threadCounts();
+  //! \brief Sets the number of threads to use in the following cases.
+  void setThreads(int nThreads);
+}
+
+
+//! \brief Defines and registers a benchmark function.
+#define IFEM_BENCHMARK(name) \
+  static void name(bench::Runner&); \
+  static bool name##_registered = bench::add(#name,name); \
+  static void name(bench::Runner& runner)
+
+#endif
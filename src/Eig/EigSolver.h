@@ -7,7 +7,7 @@
 //!
 //! \author Knut Morten Okstad / SINTEF
 //!
-//! \brief Interface to LAPack, ARPack and SLEPc eigenvalue solvers.
+//! \brief Interface to LAPack, ARPack, SLEPc and native eigenvalue solvers.
 //!
 //==============================================================================
 
@@ -21,6 +21,33 @@ class SystemMatrix;
 
 namespace eig //! Top-level functions for invoking eigenproblem solvers.
 {
+  /*!
+    \brief Data retained between successive solutions of similar eigenproblems.
+    \details The eigenvectors of the previous solution are used as starting
+    vectors for the next one, and the shifted coefficient matrix is retained
+    such that its equation ordering (symbolic factorization) can be reused.
+  */
+
+  struct WarmStart
+  {
+    Matrix        eigVec;   //!< Eigenvectors of the previous solution
+    SystemMatrix* AM;       //!< Shifted coefficient matrix of previous solution
+    bool          subspace; //!< If \e true, use subspace iterations if possible
+    int           maxIter;  //!< Maximum number of subspace iterations
+    double        tol;      //!< Relative eigenvalue tolerance (subspace only)
+    int           nIter;    //!< Number of iterations in the last solution
+    int           nOpx;     //!< Number of OP*x operations in the last solution
+    bool  subspaceUsed; //!< If \e true, the last solution used subspace iters
+
+    //! \brief Default constructor.
+    WarmStart() : AM(nullptr), subspace(false), maxIter(20), tol(1.0e-8),
+                  nIter(0), nOpx(0), subspaceUsed(false) {}
+    //! \brief No copying of this class.
+    WarmStart(const WarmStart&) = delete;
+    //! \brief The destructor frees the retained coefficient matrix.
+    ~WarmStart();
+  };
+
   //! \brief Solves the eigenvalue problem using LAPACK::DSYGVX.
   //! \details For dense matrices only and no shift.
   //! \param A The system stiffness matrix
@@ -31,18 +58,30 @@ namespace eig //! Top-level functions for invoking eigenproblem solvers.
   bool solve(SystemMatrix* A, SystemMatrix* B,
 	     Vector& eigVal, Matrix& eigVec, int nev);
 
-  //! \brief Solves the eigenvalue problem (A-lambda*B)*x = 0 using ARPACK.
+  //! \brief Solves the eigenvalue problem (A-lambda*B)*x = 0 using ARPACK,
+  //! or one of the native sparse eigensolvers.
   //! \param A The system stiffness matrix
   //! \param B The system mass matrix
   //! \param[out] eigVal Computed eigenvalues
   //! \param[out] eigVec Computed eigenvectors
   //! \param[in] nev Number of eigenvalues/vectors (see ARPack documentation)
   //! \param[in] ncv Number of Arnoldi vectors (see ARPack documentation)
-  //! \param[in] mode Eigensolver method (1,...5, see ARPack documentation)
+  //! \param[in] mode Eigensolver method (1,...,6: ARPack, see its documentation,
+  //! 7: Native shift-invert Lanczos, 8: Native LOBPCG for the lowest modes)
   //! \param[in] shift Eigenvalue shift
+  //! \param warm Optional data from the previous solution, for warm-start
+  //!
+  //! \details If \a warm is given and contains eigenvectors from a previous
+  //! solution, their sum is used as the starting vector of the Arnoldi
+  //! iterations. If \a warm->subspace is \e true, the eigenproblem is instead
+  //! solved by subspace iterations starting from the previous eigenvectors
+  //! (in the shift-and-invert \a mode 4 only). If the subspace iterations do
+  //! not converge, the Arnoldi iterations are used instead.
+  //! The native solvers (\a mode 7 and 8) use the previous eigenvectors
+  //! as starting vectors (the Lanczos solver uses their sum).
   bool solve(SystemMatrix* A, SystemMatrix* B,
 	     Vector& eigVal, Matrix& eigVec, int nev, int ncv,
-	     int mode = 4, double shift = 0.0);
+	     int mode = 4, double shift = 0.0, WarmStart* warm = nullptr);
 }
 
 #endif
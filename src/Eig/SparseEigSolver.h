@@ -0,0 +1,72 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SparseEigSolver.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Native Lanczos and LOBPCG solvers for sparse eigenvalue problems.
+//!
+//==============================================================================
+
+#ifndef _SPARSE_EIG_SOLVER_H
+#define _SPARSE_EIG_SOLVER_H
+
+#include "MatVec.h"
+
+class SystemMatrix;
+
+
+namespace eig
+{
+  //! \brief Solves the generalized eigenproblem by shift-invert Lanczos.
+  //! \param[in] K The system stiffness matrix
+  //! \param[in] M The system mass matrix
+  //! \param AM The shifted matrix (K - shift*M), factorized on first use
+  //! \param[out] eigVal Computed eigenvalues
+  //! \param[out] eigVec Computed eigenvectors
+  //! \param[in] nev Number of eigenvalues/vectors to compute
+  //! \param[in] ncv Number of Lanczos vectors
+  //! \param[in] shift Eigenvalue shift
+  //! \param[in] X0 Optional start vectors (their sum is used)
+  //! \param[out] nIter Number of restart cycles
+  //! \param[out] nOpx Number of OP*x operations
+  //! \param[in] maxIter Maximum number of restart cycles
+  //! \param[in] tol Relative tolerance on the Ritz value residuals
+  //!
+  //! \details The eigenvalues closest to \a shift are computed, using the
+  //! thick-restart variant of the implicitly restarted Lanczos method, with
+  //! full reorthogonalization in the \b M -inner product.
+  //! The eigenvectors are \b M -orthonormal.
+  bool lanczos(const SystemMatrix& K, const SystemMatrix& M, SystemMatrix& AM,
+               Vector& eigVal, Matrix& eigVec, int nev, int ncv, double shift,
+               const Matrix* X0, int& nIter, int& nOpx,
+               int maxIter = 300, double tol = 1.0e-10);
+
+  //! \brief Solves the generalized eigenproblem by the LOBPCG method.
+  //! \param[in] K The system stiffness matrix
+  //! \param[in] M The system mass matrix
+  //! \param T The preconditioner (K - shift*M), factorized on first use
+  //! \param[out] eigVal Computed eigenvalues
+  //! \param[out] eigVec Computed eigenvectors
+  //! \param[in] nev Number of eigenvalues/vectors to compute
+  //! \param[in] ncv Upper limit on the block size
+  //! \param[in] X0 Optional start vectors
+  //! \param[out] nIter Number of iterations
+  //! \param[out] nOpx Number of preconditioner applications
+  //! \param[in] maxIter Maximum number of iterations
+  //! \param[in] tol Relative tolerance on the residuals
+  //!
+  //! \details The lowest eigenvalues are computed by the locally optimal
+  //! block preconditioned conjugate gradient method of Knyazev.
+  //! The block size is min(\a ncv, \a nev + max(2,\a nev/2)).
+  //! The eigenvectors are \b M -orthonormal.
+  bool lobpcg(const SystemMatrix& K, const SystemMatrix& M, SystemMatrix& T,
+              Vector& eigVal, Matrix& eigVec, int nev, int ncv,
+              const Matrix* X0, int& nIter, int& nOpx,
+              int maxIter = 500, double tol = 1.0e-8);
+}
+
+#endif
@@ -1,4 +1,4 @@
-      subroutine eig_drv3 (n,nev,ncv,d,v,work,ierr)
+      subroutine eig_drv3 (n,nev,ncv,d,v,work,ierr,istat)
 c
 c $Id$
 c-----------------------------------------------------------------------
@@ -20,7 +20,7 @@ c
 c     ... Use mode 2 of DSAUPD.
 c
 c\Usage:
-c  call eig_drv3 ( N, NEV, NCV, D, V, WORK, IERR )
+c  call eig_drv3 ( N, NEV, NCV, D, V, WORK, IERR, ISTAT )
 c
 c\Arguments
 c  N       Integer.  (INPUT)
@@ -38,11 +38,18 @@ c
 c  V       Double precision  N by NCV array.  (OUTPUT)
 c          The NCV columns of V contain the Lanczos basis vectors.
 c
-c  WORK    Double precision  work array.  (OUTPUT/WORKSPACE)
+c  WORK    Double precision  work array.  (INPUT/OUTPUT/WORKSPACE)
+c          If IERR = 1 on input, WORK(3*N+NCV*(NCV+8)+1:...+N) contains
+c          the starting vector for the Arnoldi iterations.
 c
+c  IERR    Integer.  (INPUT/OUTPUT)
+c          On input: 1 if a starting vector is given in WORK, otherwise
+c          a random starting vector is used.
+c          On output: Error flag.
 c
-c  IERR    Integer.  (OUTPUT)
-c          Error flag.
+c  ISTAT   Integer array of length 2.  (OUTPUT)
+c          ISTAT(1): Number of implicit Arnoldi update iterations taken.
+c          ISTAT(2): Number of OP*x operations.
 c
 c\EndDoc
 c-----------------------------------------------------------------------
@@ -72,7 +79,7 @@ c     %-----------%
 c     | Arguments |
 c     %-----------%
 C
-      integer          n, nev, ncv, ierr
+      integer          n, nev, ncv, ierr, istat(2)
       Double precision d(ncv,2), v(n,ncv), work(*)
 c
 c     %--------------%
@@ -131,13 +138,16 @@ c     | precision is used.  The variable IDO is used for |
 c     | reverse communication and is initially set to 0. |
 c     | Setting INFO=0 indicates that a random vector is |
 c     | generated in DSAUPD to start the Arnoldi         |
-c     | iteration.                                       |
+c     | iteration, whereas INFO=1 indicates that the     |
+c     | starting vector is given in WORK(IPRESID).       |
 c     %--------------------------------------------------%
 c
       lworkl = ncv*(ncv+8)
       tol = 0.0D0
       ido = 0
-      ierr = 0
+      if (ierr .ne. 1) ierr = 0
+      istat(1) = 0
+      istat(2) = 0
 c
 c     %---------------------------------------------------%
 c     | This program uses exact shifts with respect to    |
@@ -267,6 +277,9 @@ c     |                                           |
 c     | Eigenvectors may also be computed now if  |
 c     | desired.  (indicated by rvec = .true.)    |
 c     %-------------------------------------------%
+c
+      istat(1) = iparam(3)
+      istat(2) = iparam(9)
 c
       call dseupd (.true., 'All', work(ipselec), d, v, n, sigma,
      &             bmat, n, which, nev, tol, work(ipresid),
@@ -138,7 +138,9 @@ public:
   //! \param[out] eigVal Computed eigenvalues
   //! \param[out] eigVec Computed eigenvectors stored column by column
   //! \param[in] nev The number of eigenvalues and eigenvectors to compute
-  bool solveEig(RealArray& eigVal, Matrix& eigVec, int nev);
+  //! \param[in] verbose If \e false, the solver is silent on success
+  bool solveEig(RealArray& eigVal, Matrix& eigVec, int nev,
+                bool verbose = true);
 
   //! \brief Solves a non-symmetric eigenproblem.
   //! \details The eigenproblem is assumed to be on the form
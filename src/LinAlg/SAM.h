@@ -15,6 +15,7 @@
 #define _SAM_H
 
 #include "MatVec.h"
+#include "Profiler.h"
 #include <set>
 
 class SystemMatrix;
@@ -336,6 +337,8 @@ protected:
 
   std::vector<char> nodeType; //!< Nodal DOF classification
 
+  utl::MemAccount myMem; //!< Memory owned by the SAM arrays
+
   friend class DenseMatrix;
   friend class SPRMatrix;
   friend class SparseMatrix;
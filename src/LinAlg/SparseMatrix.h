@@ -15,6 +15,7 @@
 #define _SPARSE_MATRIX_H
 
 #include "SystemMatrix.h"
+#include "Profiler.h"
 #include <iostream>
 #include <map>
 #include <set>
@@ -235,6 +236,9 @@ protected:
   //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
   bool solveSLUx(Vector& B, Real* rcond);
 
+  //! \brief Updates the memory account of the matrix storage.
+  void accountMemory();
+
   //! \brief Writes the system matrix to the given output stream.
   virtual std::ostream& write(std::ostream& os) const;
 
@@ -260,6 +264,12 @@ private:
   SuperLUdata*    slu; //!< Matrix data for the SuperLU equation solver
   int      numThreads; //!< Number of threads to use for the SuperLU_MT solver
 
+  //! Per-thread partial products of multiply(), retained between the calls
+  mutable std::vector<Real> mulBuf;
+
+  utl::MemAccount myMem;  //!< Memory owned by the matrix storage
+  utl::MemAccount sluMem; //!< Memory owned by the SuperLU L/U factors
+
 protected:
   IntVec IA; //!< Identifies the beginning of each row or column
   IntVec JA; //!< Specifies column/row index of each nonzero element
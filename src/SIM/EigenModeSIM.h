@@ -16,10 +16,16 @@
 
 #include "MultiStepSIM.h"
 #include "SIMbase.h"
+#include "EigSolver.h"
 
 
 /*!
   \brief Driver for computing a time history from a set of eigen mode shapes.
+  \details The eigenmodes are by default computed once, in initSol().
+  Optionally, they may be recomputed at regular step intervals (modal tracking
+  of time-dependent operators). The eigensolver is then warm-started from the
+  eigenvectors of the previous solution, and the new modes are matched with
+  the previous ones such that each amplitude follows its mode.
 */
 
 class EigenModeSIM : public MultiStepSIM
@@ -51,8 +57,23 @@ public:
                                     double zero_tolerance,
                                     std::streamsize outPrec);
 
+  //! \brief Matches new eigenmodes with the previous ones.
+  //! \param modes The previous modes, updated with the matching new modes
+  //! \param newModes The new modes (the eigenvectors are moved from it)
+  //!
+  //! \details Each previous mode is replaced by the new mode with the largest
+  //! modal assurance criterion (MAC) with respect to it. The sign of the new
+  //! mode shape is flipped if needed, to keep the sign consistent.
+  static void matchModes(std::vector<Mode>& modes, std::vector<Mode>& newModes);
+
+protected:
+  //! \brief Solves the eigenvalue problem at the given time.
+  bool computeModes(const TimeDomain& time);
+
 private:
   double              myStart;   //!< The start time of this simulator
+  int                 nUpdate;   //!< Number of steps between mode updates
+  eig::WarmStart      warm;      //!< Eigensolver warm-start data
   std::vector<Mode>   modes;     //!< Eigenmode shapes and frequencies
   std::vector<double> amplitude; //!< Eigenmode shape amplitudes
   std::vector<double> omega;     //!< Applied angular frequencies
@@ -82,7 +82,77 @@ protected:
   //! \brief Returns the last step that was save to VTF
   int getLastSavedStep() const { return lastSt; }
 
+  //! \brief Parses the Jacobian-free Newton-Krylov parameters from XML.
+  //! \param[in] elem The XML element to parse
+  void parseJFNK(const TiXmlElement* elem);
+  //! \brief Returns whether Jacobian-free Newton-Krylov iterations are used.
+  bool useJFNK() const { return jfnk.maxIter > 0; }
+  //! \brief Checks whether the preconditioner should be reassembled now.
+  //! \param[in] param Time stepping parameters
+  bool newPreconditioner(const TimeStep& param);
+
+  //! \brief Solves the linearized system by Jacobian-free GMRES iterations.
+  //! \param[in] param Time stepping parameters
+  //! \param[in] newPrec \e true if the preconditioner has been reassembled
+  //!
+  //! \details The Jacobian is applied through finite difference directional
+  //! derivatives of the residual vector, such that only residual assembly
+  //! is needed. The last assembled coefficient matrix (if any) is used as
+  //! a right preconditioner.
+  bool solveJFNK(const TimeStep& param, bool newPrec);
+  //! \brief Applies the Jacobian to a vector by finite differences.
+  //! \param[in] param Time stepping parameters
+  //! \param[in] r0 Residual vector of the unperturbed state
+  //! \param[in] unorm Norm of the unperturbed solution vector
+  //! \param[in] v The vector to apply the Jacobian to
+  //! \param[out] Jv The Jacobian-vector product
+  bool applyJacobian(const TimeStep& param, const Vector& r0, double unorm,
+                     const Vector& v, Vector& Jv);
+  //! \brief Applies the preconditioner to a vector.
+  //! \param[in] v The vector to apply the preconditioner to
+  //! \param[out] z The preconditioned vector
+  //! \param[in] newLHS \e true if the preconditioner has to be factorized
+  bool applyPreconditioner(const Vector& v, Vector& z, bool newLHS);
+  //! \brief Evaluates the residual vector for a perturbed solution state.
+  //! \param[in] param Time stepping parameters
+  //! \param[in] dx Perturbation direction (in terms of the iteration unknowns)
+  //! \param[in] eps Perturbation size
+  //! \param[out] res The resulting residual vector
+  virtual bool perturbedResidual(const TimeStep& param, const Vector& dx,
+                                 double eps, Vector& res);
+  //! \brief Finalizes the right-hand-side vector on the system level.
+  virtual void finalizeRHSvector(bool) {}
+  //! \brief Perturbs the solution state in a given direction.
+  //! \param psol The primary solution vectors to perturb
+  //! \param[in] param Time stepping parameters
+  //! \param[in] dx Perturbation direction (in terms of the iteration unknowns)
+  //! \param[in] eps Perturbation size
+  virtual void perturbSolution(Vectors& psol, const TimeStep& param,
+                               const Vector& dx, double eps) const;
+
+  //! \brief Parses the solution predictor type from an XML value string.
+  //! \param[in] value The predictor type name
+  //! \return \e false if \a value is not an extrapolating predictor
+  bool parsePredictor(const char* value);
+  //! \brief Returns whether an extrapolating solution predictor is used.
+  bool useExtrapolation() const { return extrap.type != 'c'; }
+  //! \brief Predicts the primary solution by extrapolating converged states.
+  //! \param[out] u The predicted primary solution vector
+  //! \param[in] t Time/load parameter to predict the solution at
+  //! \return \e false if too few states are available, \a u is then untouched
+  bool extrapolate(Vector& u, double t);
+  //! \brief Stores a converged primary solution in the predictor history.
+  //! \param[in] u The converged primary solution vector
+  //! \param[in] param Time stepping parameters
+  //!
+  //! \details The predicted and converged increments are also logged here.
+  void acceptSolution(const Vector& u, const TimeStep& param);
+
 public:
+  //! \brief Clears the solution history of the extrapolating predictor.
+  //! \details Must be invoked when the solution state is reset externally.
+  void resetPredictor() { extrap.sol.clear(); extrap.time.clear(); }
+
   //! \brief Initializes the geometry block counter.
   void setStartGeo(int gID);
 
@@ -171,6 +241,9 @@ protected:
 
   NormOp refNopt; //!< Reference norm option
   double refNorm; //!< Reference norm value used in convergence checks
+  double convTol; //!< Current convergence tolerance
+  double prvNorm; //!< Iteration norm of the previous iteration
+  int    nIncrs;  //!< Number of consecutive iterations with increasing norm
   SubIt  subiter; //!< Subiteration flag
   size_t nRHSvec; //!< Number of right-hand-side vectors to assemble
   char   rotUpd;  //!< Option for how to update of nodal rotations
@@ -178,6 +251,42 @@ protected:
   int geoBlk; //!< Running VTF geometry block counter
   int nBlock; //!< Running VTF result block counter
 
+  //! \brief Struct with Jacobian-free Newton-Krylov solution parameters.
+  struct JFNKParams
+  {
+    int    maxIter;  //!< Maximum number of Krylov iterations (0: JFNK is off)
+    int    kDim;     //!< Krylov subspace dimension (GMRES restart length)
+    double rTol;     //!< Relative tolerance for the Krylov iterations
+    double epsFD;    //!< Relative finite difference perturbation size
+    bool   precond;  //!< If \e true, use the assembled tangent as preconditioner
+    int    nUpdate;  //!< Number of steps between preconditioner updates
+    int    lastPrec; //!< Step at which the preconditioner was last assembled
+    bool   refresh;  //!< If \e true, force a preconditioner update
+    size_t nKrylov;  //!< Accumulated number of Krylov iterations
+    size_t nResid;   //!< Accumulated number of residual evaluations
+
+    //! \brief Default constructor.
+    JFNKParams() : maxIter(0), kDim(30), rTol(1.0e-4), epsFD(1.0e-7),
+                   precond(true), nUpdate(1), lastPrec(-1), refresh(false),
+                   nKrylov(0), nResid(0) {}
+  };
+
+  JFNKParams jfnk; //!< Jacobian-free Newton-Krylov parameters
+
+  //! \brief Struct with extrapolating solution predictor data.
+  struct Extrapolator
+  {
+    char      type; //!< Predictor type ('c', 'l'inear, 'q'uadratic, 's'ecant)
+    Vectors   sol;  //!< The last converged primary solutions, oldest first
+    RealArray time; //!< Time/load parameters of the stored solutions
+    Vector    incr; //!< Predicted solution increment of current step
+
+    //! \brief Default constructor.
+    Extrapolator() : type('c') {}
+  };
+
+  Extrapolator extrap; //!< Extrapolating solution predictor
+
 private:
   int lastSt; //!< The last step that was saved to VTF
 };
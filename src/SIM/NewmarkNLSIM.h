@@ -206,6 +206,13 @@ protected:
   virtual bool correctStep(TimeStep& param, bool converged);
   //! \brief Finalizes the right-hand-side vector on the system level.
   virtual void finalizeRHSvector(bool);
+  //! \brief Perturbs the solution state in a given direction.
+  //! \param psol The primary solution vectors to perturb
+  //! \param[in] param Time stepping parameters
+  //! \param[in] dx Perturbation direction (incremental displacements)
+  //! \param[in] eps Perturbation size
+  virtual void perturbSolution(Vectors& psol, const TimeStep& param,
+                               const Vector& dx, double eps) const;
 
 private:
   Vector incDis;  //!< Incremental displacements
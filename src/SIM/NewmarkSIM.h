@@ -71,8 +71,13 @@ protected:
   virtual bool predictStep(TimeStep& param);
   //! \brief Updates configuration variables (solution vector) in an iteration.
   virtual bool correctStep(TimeStep& param, bool = false);
-  //! \brief Finalizes the right-hand-side vector on the system level.
-  virtual void finalizeRHSvector(bool) {}
+  //! \brief Perturbs the solution state in a given direction.
+  //! \param psol The primary solution vectors to perturb
+  //! \param[in] param Time stepping parameters
+  //! \param[in] dx Perturbation direction (in terms of the iteration unknowns)
+  //! \param[in] eps Perturbation size
+  virtual void perturbSolution(Vectors& psol, const TimeStep& param,
+                               const Vector& dx, double eps) const;
 
 public:
   //! \brief Returns a const reference to current velocity vector.
@@ -21,6 +21,7 @@
 #include "Property.h"
 #include "Function.h"
 #include "MatVec.h"
+#include "Profiler.h"
 
 class IntegrandBase;
 class NormBase;
@@ -34,6 +35,7 @@ class SystemVector;
 class Vec4;
 class ModelGenerator;
 namespace LR { struct RefineData; }
+namespace eig { struct WarmStart; }
 
 //! Property code to integrand map
 typedef std::multimap<int,IntegrandBase*> IntegrandMap;
@@ -114,6 +116,15 @@ protected:
   int parseMaterialSet(const TiXmlElement* elem, int mindex);
   //! \brief Parses a subelement of the \a resultoutput XML-tag.
   virtual bool parseOutputTag(const TiXmlElement* elem);
+  //! \brief Reads the patch geometry from the given file.
+  //! \param[in] fileName Name of the GoTools patch file to read
+  //! \param[in] cache If \e true, write a binary cache of the patches read
+  //! \param[in] whiteSpace For message formatting
+  //!
+  //! \details If a binary cache file (\a fileName with "b" appended) exists
+  //! and is not older than \a fileName, the patches are read from it instead.
+  bool readPatchFile(const char* fileName, bool cache,
+                     const char* whiteSpace = "");
 
 private:
   //! \brief Parses a subelement of the \a geometry XML-tag.
@@ -335,6 +346,20 @@ public:
                            const char* compName = "displacement",
                            bool newLHS = true, size_t idxRHS = 0);
 
+  //! \brief Solves the current linear system for an arbitrary right-hand-side.
+  //! \param[out] solution Global solution vector in DOF-order
+  //! \param[in] rhs Global right-hand-side vector in DOF-order
+  //! \param[in] newLHS If \e false, reuse the LHS-matrix factorization
+  //!
+  //! \details This method is used to apply the (possibly lagged) assembled
+  //! coefficient matrix as a preconditioner in matrix-free iterations.
+  //! The prescribed (slave) DOFs of \a solution are set to zero.
+  bool solveForRHS(Vector& solution, const Vector& rhs, bool newLHS = false);
+
+  //! \brief Returns the current prescribed DOF increments in DOF-order.
+  //! \param[out] incr Global vector with nonzero values at prescribed DOFs only
+  bool getDirichletIncrements(Vector& incr) const;
+
   //! \brief Solves a linear system of equations with multiple right-hand-sides.
   //! \param[out] solution Global primary solution vector
   //! \param[in] printSol Print solution if its size is less than \a printSol
@@ -447,9 +472,10 @@ public:
   //! \param[out] solution Computed eigenvalues and associated eigenvectors
   //! \param[in] iA Index of system matrix \b A in \a myEqSys->A
   //! \param[in] iB Index of system matrix \b B in \a myEqSys->A
+  //! \param warm Optional data for warm-starting from a previous solution
   bool systemModes(std::vector<Mode>& solution,
 		   int nev, int ncv, int iop, double shift,
-		   size_t iA = 0, size_t iB = 1);
+		   size_t iA = 0, size_t iB = 1, eig::WarmStart* warm = nullptr);
   //! \brief Performs a generalized eigenvalue analysis of the assembled system.
   //! \param[out] solution Computed eigenvalues and associated eigenvectors
   //! \param[in] iA Index of system matrix \b A in \a myEqSys->A
@@ -713,6 +739,28 @@ protected:
   //! \param[in] p Property object identifying a patch boundary
   //! \param[in] silence If \e true, suppress threading group outprint
   void generateThreadGroups(const Property& p, bool silence = false);
+  //! \brief Generates element groups for multi-threading of all integrals.
+  //! \param[in] silence If \e true, suppress threading group outprint
+  void generateThreadGroups(bool silence);
+
+  //! \brief Performs a thread scaling study of the assembly and solution.
+  //! \param[in] time Parameters for nonlinear and time-dependent simulations
+  //! \param[in] prevSol Previous primary solution vectors in DOF-order
+  //! \param[in] poorConvg If \e true, the nonlinear driver is converging poorly
+  //!
+  //! \details The linear equation system is assembled and solved repeatedly
+  //! for each thread count given by the simulation options, and the speedup
+  //! of each phase is reported. The equation system must be re-assembled
+  //! before it is used afterwards. The study is not recorded by the profiler,
+  //! the telemetry or the load-balance summary.
+  //!
+  //! The (possibly overridden) assembleSystem() method is invoked several
+  //! times with the same input. Integrands that update internal state during
+  //! the assembly, e.g., history variables that are not reset from the input
+  //! solution, will therefore be in a different state afterwards, and the
+  //! study should not be requested for such problems.
+  bool scalingStudy(const TimeDomain& time, const Vectors& prevSol,
+                    bool poorConvg);
 
   //! \brief Adds a MADOF with an extraordinary number of DOFs on a given basis.
   //! \param[in] basis The basis to specify number of DOFs for
@@ -785,6 +833,10 @@ private:
   size_t nIntGP; //!< Number of interior integration points in the whole model
   size_t nBouGP; //!< Number of boundary integration points in the whole model
 
+  utl::MemAccount mnpcMem; //!< Memory owned by the element connectivities
+
+  bool scalingDone; //!< If \e true, the thread scaling study has been done
+
   //! Additional MADOF arrays for mixed problems (extraordinary DOF counts)
   std::map<int, std::vector<int> > mixedMADOFs;
 };
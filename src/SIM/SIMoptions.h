@@ -17,6 +17,7 @@
 #include "ASMenums.h"
 #include <iostream>
 #include <string>
+#include <vector>
 #include <map>
 
 namespace utl {
@@ -51,6 +52,8 @@ public:
   //! \brief Parses a subelement of the \a eigensolver XML-tag.
   bool parseEigSolTag(const TiXmlElement* elem);
   //! \brief Parses a subelement of the \a resultoutput XML-tag.
+  //! \details The writer settings of the \a hdf5 subelement are stored in
+  //! the global options, which the HDF5 writers are configured from.
   bool parseOutputTag(const TiXmlElement* elem);
   //! \brief Parses a projection method XML-tag.
   bool parseProjectionMethod(const char* ptype);
@@ -68,6 +71,7 @@ public:
 
 public:
   ASM::Discretization discretization; //!< Spatial discretization option
+  bool geoCache; //!< If \e true, write a binary cache of the patch geometry
 
   int nGauss[2]; //!< Gaussian quadrature rules
 
@@ -75,7 +79,7 @@ public:
   int num_threads_SLU; //!< Number of threads for SuperLU_MT
 
   // Eigenvalue solver options
-  int    eig;   //!< Eigensolver method (1,...,5)
+  int    eig;   //!< Eigensolver method (1-6: ARPACK, 7: Lanczos, 8: LOBPCG)
   int    nev;   //!< Number of eigenvalues/vectors
   int    ncv;   //!< Number of Arnoldi vectors
   double shift; //!< Eigenvalue shift
@@ -88,11 +92,30 @@ public:
   bool pSolOnly; //!< If \e true, don't save secondary solution variables
 
   std::string hdf5; //!< Prefix for HDF5-file
+
+  // The HDF5 writer settings are only used in the global options,
+  // IFEM::getOptions(), also when parsed by a simulator
+  int  hdf5Comp;  //!< Compression level of HDF5 datasets (0=NONE, 1-9=deflate)
+  int  hdf5Chunk; //!< Chunk size of HDF5 datasets (0=automatic)
+  bool hdf5Szip;  //!< If \e true, use szip instead of deflate compression
+  int  hdf5Aggr;  //!< Number of parallel HDF5 I/O aggregators (0=default)
+  int  hdf5Async; //!< Number of time levels buffered for asynchronous output
+  bool hdf5Xdmf;  //!< If \e true, write tesselated results and an XDMF index
   bool enableController; //!< Whether or not to enable external program control
 
   int printPid; //!< PID to print info to screen for
   std::string log_prefix; //!< Prefix for process log files
 
+  std::string profReport; //!< Name of machine-readable profiling report file
+  std::string traceFile; //!< Name of Chrome trace file for profiling events
+  int  traceBuffer; //!< Number of trace events buffered for each thread
+  bool hwCounters;  //!< If \e true, sample hardware performance counters
+  bool memReport;   //!< If \e true, report the memory usage of each task
+  int  loadBalance; //!< Number of most expensive elements in load reports
+  std::string telemetry; //!< Name of JSON-lines file for solver telemetry
+  std::vector<int> scaling; //!< Thread counts of the scaling study, if any
+  int scalingRuns; //!< Number of runs for each thread count in scaling study
+
   //! \brief Enum defining the available projection methods.
   enum ProjectionMethod { NONE, GLOBAL, DGL2, CGL2, SCR, VDSA, QUASI, LEASTSQ };
   //! \brief Projection method name mapping.
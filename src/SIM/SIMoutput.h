@@ -266,6 +266,17 @@ protected:
   //! \brief Preprocesses the result sampling points.
   virtual void preprocessResultPoints();
 
+  //! \brief Evaluates a nodal field at the visualization points of each patch.
+  //! \param[out] fields Field values at the visualization points of each patch
+  //! \param[in] vec Global nodal field vector
+  //! \param[in] nndof Number of field components per node
+  //! \param[in] basis Which basis to extract the nodal values for
+  //!
+  //! \details The patches are evaluated in parallel, and the results are
+  //! returned in patch order such that the subsequent output is deterministic.
+  bool evalPatchFields(std::vector<Matrix>& fields, const Vector& vec,
+                       unsigned char nndof = 0, int basis = 0) const;
+
 private:
   //! \brief Struct defining a result sampling point.
   struct ResultPoint
@@ -0,0 +1,96 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SolverMonitor.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Live progress queries and retuning of a running simulation.
+//!
+//==============================================================================
+
+#ifndef _SOLVER_MONITOR_H
+#define _SOLVER_MONITOR_H
+
+#include "ControlFIFO.h"
+#include <deque>
+
+class DataExporter;
+class TimeStep;
+
+
+/*!
+  \brief Class answering progress queries over the control fifo.
+
+  \details The time stepping driver reports each completed step through the
+  addStep() method. The progress can then be queried while the simulation is
+  running, by writing
+  \code
+  <query><solver/></query>
+  \endcode
+  to the control fifo. The reply contains the current step and time, the
+  average wall time per step and the estimated remaining wall time, the
+  current and peak memory usage, the current and maximum number of threads,
+  and the iteration counts of the most recent steps. A profiler snapshot of the completed tasks is added if the query
+  contains a \a profile element, i.e., <tt>\<solver\>\<profile/\>\</solver\></tt>.
+
+  The following commands can be used to retune the simulation:
+  \code
+  <control><solver><set_save_inc value="10"/><set_threads value="4"/></solver></control>
+  \endcode
+  where \a set_save_inc sets the time step interval of the result output,
+  and \a set_threads sets the number of threads of the parallel regions.
+  The element thread groups and the per-thread buffers of the expression
+  functions are sized during preprocessing, so the number of threads can only
+  be reduced, up to the number in effect when the monitor was created.
+  Larger values are refused.
+
+  The queries and commands are only handled when the control fifo is polled,
+  which the time stepping driver does between the time steps. A query issued
+  during a long step is therefore answered when that step has completed.
+*/
+
+class SolverMonitor : public ControlCallback
+{
+public:
+  //! \brief The constructor initializes the step statistics.
+  //! \param[in] nTrend Number of recent steps in the iteration trend
+  explicit SolverMonitor(size_t nTrend = 10);
+  //! \brief Empty destructor.
+  virtual ~SolverMonitor() {}
+
+  //! \brief Sets the result exporter that is retuned by \a set_save_inc.
+  void setExporter(DataExporter* exporter) { myExporter = exporter; }
+
+  //! \brief Records a completed time step.
+  //! \param[in] tp Time stepping information of the completed step
+  //! \param[in] wallTime Wall time spent on the step, including output
+  void addStep(const TimeStep& tp, double wallTime);
+
+  //! \brief Callback on receiving a XML control block.
+  virtual void OnControl(const TiXmlElement* context);
+  //! \brief Callback on receiving a XML query block.
+  virtual bool OnQuery(const TiXmlElement* context, std::ostream& os);
+  //! \brief Returns context name for callback.
+  virtual std::string GetContext() const { return "solver"; }
+
+private:
+  DataExporter* myExporter; //!< Result exporter, if any
+
+  int    step;     //!< Last completed time step
+  double time;     //!< Simulation time of the last completed step
+  double stopTime; //!< Stop time of the simulation
+  size_t nSteps;   //!< Number of completed steps
+  double simTime;  //!< Simulation time covered by the completed steps
+  double wallTime; //!< Wall time spent on the completed steps
+  double lastWall; //!< Wall time spent on the last step
+
+  int maxThreads; //!< Number of threads the thread groups were made for
+
+  size_t          maxTrend; //!< Number of recent steps in the iteration trend
+  std::deque<int> trend;    //!< Iteration counts of the most recent steps
+};
+
+#endif
@@ -15,6 +15,7 @@
 #define CONTROL_FIFO_H_
 
 #include <string>
+#include <iostream>
 #include <map>
 
 class TiXmlElement;
@@ -29,6 +30,12 @@ class ControlCallback
 public:
   //! \brief Callback on receiving a XML control block.
   virtual void OnControl(const TiXmlElement* context) = 0;
+  //! \brief Callback on receiving a XML query block.
+  //! \param[in] context The query block
+  //! \param os Output stream for the XML-formatted reply
+  //! \return \e false if queries are not supported by this handler
+  virtual bool OnQuery(const TiXmlElement* context, std::ostream& os)
+  { return false; }
   //! \brief Returns context name for callback.
   virtual std::string GetContext() const = 0;
 };
@@ -39,13 +46,21 @@ public:
 
   \details A fifo is opened, and users can write instructions to the fifo
            in XML format. These are then processed between time steps.
+
+           If the root element of the received data is \a query, the
+           callbacks are asked for a reply instead, which is written to a
+           second fifo with the suffix \a -reply, e.g.
+  \code
+  echo '<query><solver/></query>' > ifem-control; cat ifem-control-reply
+  \endcode
+           The reply is dropped if no reader is attached to the reply fifo.
 */
 
 class ControlFIFO
 {
 public:
   //! \brief Default constructor.
-  ControlFIFO() : fifo(-1) {}
+  ControlFIFO() : fifo(-1), replied(false) {}
 
   //! \brief The destructor tears down the opened fifo and removes the file.
   ~ControlFIFO();
@@ -53,6 +68,9 @@ public:
   //! \brief Registers a callback handler.
   //! \param[in] callback The callback handler to register
   void registerCallback(ControlCallback& callback);
+  //! \brief Unregisters a callback handler.
+  //! \param[in] callback The callback handler to unregister
+  void unregisterCallback(ControlCallback& callback);
 
   //! \brief Opens the fifo and prepares for receiving.
   //! \param[in] name The name of the filesystem entry for the fifo
@@ -62,8 +80,12 @@ public:
   void poll();
 
 private:
+  //! \brief Writes a reply to the reply fifo.
+  void reply(const std::string& text);
+
   std::string fifo_name; //!< Name of filesystem entry of our fifo
   int         fifo;      //!< fifo handle
+  bool        replied;   //!< If \e true, the reply fifo has been created
 
   std::map<std::string,ControlCallback*> callbacks; //!< Registered callbacks
 };
@@ -28,6 +28,15 @@ class TimeStep;
 
   \details This class holds a list of data writers,
   and the SIM classes or vectors to write.
+
+  The time levels may optionally be written asynchronously by a background
+  thread. The registered solution vectors are then snapshotted when a time
+  level is dumped, and the solver proceeds while the data is written.
+  Time levels with fields that need evaluation on the SIM object (secondary
+  solutions, norms, eigenmodes and knot span fields), or with an updated
+  geometry, are still written synchronously. The asynchronous output is only
+  available in serial runs, since the writers use collective MPI and parallel
+  HDF5 operations that must not run concurrently with those of the solver.
 */
 
 class DataExporter : public ControlCallback
@@ -69,6 +78,9 @@ public:
     std::string prefix;      //!< Field name prefix
     bool enabled;            //!< Whether or not field is enabled
     int  ncmps;              //!< Number of components. Use to override SIM info
+    int  compress;           //!< \brief Compression level of the field data.
+                             //! \details A negative value means the default
+                             //! of the writer, 0 means no compression.
   };
 
   //! \brief Default constructor.
@@ -78,9 +90,10 @@ public:
   //! (always dumps order solutions in a row)
   DataExporter(bool dynWriters = false, int ndump=1, int order=1) :
     m_delete(dynWriters), m_level(-1), m_ndump(ndump), m_order(order),
-    m_last_step(-1), m_infoReader(0), m_dataReader(0) {}
+    m_last_step(-1), m_infoReader(0), m_dataReader(0), m_async(nullptr) {}
 
   //! \brief The destructor deletes the writers if \a dynWriters was \e true.
+  //! \details Pending asynchronous output is written first.
   virtual ~DataExporter();
 
   //! \brief Registers an entry for storage.
@@ -90,10 +103,12 @@ public:
   //! \param[in] results Which results to store
   //! \param[in] prefix Field name prefix
   //! \param[in] ncmps Number of field components
+  //! \param[in] compress Compression level (-1 = writer default, 0 = none)
   bool registerField(const std::string& name,
                      const std::string& description,
                      FieldType field, int results = PRIMARY,
-                     const std::string& prefix = "", int ncmps = 0);
+                     const std::string& prefix = "", int ncmps = 0,
+                     int compress = -1);
 
   //! \brief Registers a data writer.
   //! \param[in] writer A pointer to the data writer we want registered
@@ -114,6 +129,19 @@ public:
   //! \param[in] geometryUpdated Whether or not geometries are updated
   bool dumpTimeLevel(const TimeStep* tp=nullptr, bool geometryUpdated=false);
 
+  //! \brief Enables asynchronous output in a background thread.
+  //! \param[in] nBuffer Maximum number of time levels pending output
+  //! \return \e false if asynchronous output is not available,
+  //! e.g., in parallel runs
+  //!
+  //! \details When \a nBuffer time levels are pending, the next dump waits
+  //! until the oldest one has been written. If \a nBuffer is zero,
+  //! the pending output is written and the asynchronous output is disabled.
+  bool setAsync(int nBuffer = 2);
+  //! \brief Waits until all pending time levels have been written.
+  //! \return \e false if writing of a pending time level failed
+  bool flush();
+
   //! \brief Loads last time level with first registered writer by default.
   //! \param[in] level Time level to load, defaults to last time level
   //! \param[in] info DataWriter to read the info from (e.g. the XML writer)
@@ -141,12 +169,31 @@ public:
   std::string getName() const;
 
   int getStride() const { return m_ndump; }
+  //! \brief Sets the time level stride for dumping.
+  void setStride(int ndump) { if (ndump > 0) m_ndump = ndump; }
   int getOrder() const { return m_order; }
 
 protected:
   //! \brief Internal helper function.
   int getWritersTimeLevel() const;
 
+  //! \brief Internal helper function. Writes a time level with all writers.
+  //! \param[in] level The time level to write
+  //! \param[in] entries The fields to write
+  //! \param[in] tp Current time stepping info
+  //! \param[in] geometryUpdated Whether or not geometries are updated
+  //! \param[out] messages Messages of the writers, to be printed
+  bool writeTimeLevel(int level, const std::map<std::string,FileEntry>& entries,
+                      const TimeStep* tp, bool geometryUpdated,
+                      std::string& messages);
+
+  //! \brief Checks if a field can be written from snapshotted data.
+  //! \param[in] entry The field to check
+  //! \param[in] geometryUpdated Whether or not geometries are updated
+  static bool isAsyncSafe(const FileEntry& entry, bool geometryUpdated);
+
+  struct AsyncWriter;
+
   //! A map of field names -> field info structures
   std::map<std::string,FileEntry> m_entry;
   //! A vector of registered data writers
@@ -160,6 +207,8 @@ protected:
 
   DataWriter* m_infoReader; //!< DataWriter to read data information from
   DataWriter* m_dataReader; //!< DataWriter to read numerical data from
+
+  AsyncWriter* m_async; //!< Background writer for asynchronous output
 };
 
 //! \brief Convenience type
@@ -247,6 +296,12 @@ public:
   virtual bool writeTimeInfo(int level, int order, int interval,
                              const TimeStep& tp) = 0;
 
+  //! \brief Returns the messages of the time levels written since last time,
+  //! and clears them.
+  //! \details The messages are printed by the DataExporter, such that
+  //! nothing is printed from the asynchronous writer thread.
+  virtual std::string takeMessages() { return std::string(); }
+
   //! \brief Sets the prefices used for norm output.
   void setNormPrefixes(const char** prefix) { m_prefix = prefix; }
 
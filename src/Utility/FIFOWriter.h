@@ -0,0 +1,65 @@
+// $Id$
+//==============================================================================
+//!
+//! \file FIFOWriter.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Non-blocking writing to a named pipe.
+//!
+//==============================================================================
+
+#ifndef _FIFO_WRITER_H
+#define _FIFO_WRITER_H
+
+#include <string>
+
+
+/*!
+  \brief Class for writing to a named pipe without stalling the application.
+
+  \details The pipe is opened in non-blocking mode, which fails as long as
+  no reader is attached, such that the opening should be re-attempted before
+  each write. SIGPIPE is blocked in the calling thread only while writing,
+  and a SIGPIPE raised by a reader that has gone away is consumed, such that
+  the signal disposition of the process is not changed.
+*/
+
+class FIFOWriter
+{
+public:
+  //! \brief The constructor sets the name of the pipe.
+  explicit FIFOWriter(const std::string& name) : fifoName(name), fd(-1) {}
+  //! \brief The destructor closes the pipe.
+  ~FIFOWriter() { this->close(); }
+
+  //! \brief Opens the pipe for non-blocking writing, if not yet open.
+  //! \return \e false if no reader is attached to the pipe
+  bool open();
+  //! \brief Closes the pipe.
+  void close();
+  //! \brief Returns \e true if the pipe is open.
+  bool isOpen() const { return fd >= 0; }
+  //! \brief Returns the number of bytes that can be written without waiting.
+  //! \details Where the free space of the pipe can not be queried, PIPE_BUF
+  //! is returned, since writes up to that size are all-or-nothing.
+  size_t available() const;
+
+  //! \brief Writes data to the pipe.
+  //! \param[in] data The data to write
+  //! \param[in] len Number of bytes to write
+  //! \param[in] maxWait Maximum time (in milliseconds) to wait for the reader
+  //! when the pipe is full
+  //! \return Number of bytes written
+  //!
+  //! \details If the reader has gone away, the pipe is closed.
+  size_t write(const char* data, size_t len, int maxWait = 0);
+
+private:
+  std::string fifoName; //!< Name of the pipe
+  int         fd;       //!< File descriptor of the pipe
+};
+
+#endif
@@ -16,6 +16,7 @@
 
 #include "Function.h"
 #include <string>
+#include <vector>
 
 class Field;
 class ASMbase;
@@ -48,4 +49,51 @@ protected:
   virtual Real evaluate(const Vec3& X) const;
 };
 
+
+/*!
+  \brief A scalar-valued space-time function, streamed from a HDF5 file.
+  \details Unlike FieldFunction, the field is not loaded into memory up front.
+  Only the patches and time levels needed by the evaluation points are read,
+  and they are kept in a bounded least-recently-used cache. The function value
+  is interpolated linearly in time between the two time levels bracketing the
+  time coordinate of the evaluation point. Whenever a time level is needed,
+  the next one is prefetched in a background thread.
+
+  The patch geometries are read when the function is created. The patch to
+  evaluate is found by locating the evaluation point in the patch geometries,
+  and the field is evaluated at the parameters of the closest point. An error
+  is reported if the point is outside all patches.
+*/
+
+class FieldStreamFunction : public RealFunc
+{
+public:
+  //! \brief The constructor opens the HDF5 file and reads the time levels.
+  //! \param[in] fileName Name of the HDF5-file
+  //! \param[in] basisName Name of the basis which the field values refer to
+  //! \param[in] fieldName Name of the field in the HDF5-file
+  //! \param[in] cacheSize Maximum number of patch-level fields kept in memory
+  FieldStreamFunction(const std::string& fileName,
+                      const std::string& basisName,
+                      const std::string& fieldName,
+                      size_t cacheSize = 8);
+  //! \brief The destructor stops the prefetch thread and frees the cache.
+  virtual ~FieldStreamFunction();
+
+  //! \brief Returns whether the function is time-independent or not.
+  virtual bool isConstant() const { return false; }
+
+  //! \brief Returns the (time level, patch index) of the cached fields.
+  //! \details The fields are listed in order of last use, most recent first.
+  std::vector<std::pair<int,int>> getCachedFields() const;
+
+protected:
+  //! \brief Evaluates the scalar field function.
+  virtual Real evaluate(const Vec3& X) const;
+
+private:
+  struct Stream;
+  Stream* data; //!< The field cache and the prefetch thread
+};
+
 #endif
@@ -15,8 +15,11 @@
 #define _HDF5_WRITER_H
 
 #include "DataExporter.h"
+#include <map>
+#include <set>
 
 class SIMbase;
+class ASMbase;
 
 
 /*!
@@ -25,6 +28,27 @@ class SIMbase;
   \details The HDF5 writer writes data to a HDF5 file.
   It supports parallel I/O, and can be used to add restart capability
   to applications.
+
+  The datasets may optionally be stored chunked and compressed, using the
+  shuffle and deflate filters (or szip). The compression level is given per
+  field through the DataExporter registration, with a default taken from the
+  global simulation options. Restart data is not compressed by default.
+
+  In parallel, the datasets of one time level are not written immediately.
+  They are queued until the file is closed, and the array lengths of all
+  processes are then exchanged in a single collective operation. The datasets
+  are created up front and written with collective MPI-IO transfers, which
+  optionally are aggregated onto a subset of the processes (the MPI-IO
+  collective buffering nodes). The queue holds a copy of the data, so it is
+  written earlier (after a patch or a field) if it exceeds 64 MB on any
+  process, which bounds the extra memory used for the batching.
+
+  Optionally, the primary and secondary solution fields of SIM entries are
+  also written at the tesselated visualization points of each patch, together
+  with the tesselated grid itself (only when the geometry changes).
+  An XDMF index file (with extension .xmf) is then written alongside the HDF5
+  file, referencing these datasets in place, such that the results can be
+  opened directly in ParaView or VisIt.
 */
 
 class HDF5Writer : public DataWriter
@@ -40,6 +64,12 @@ public:
   //! \brief Empty destructor.
   virtual ~HDF5Writer() {}
 
+  //! \brief Sets the default chunking and compression of the datasets.
+  //! \param[in] level Deflate compression level (0 = none, 1-9)
+  //! \param[in] chunk Chunk size, in number of values (0 = automatic)
+  //! \param[in] szip If \e true, use szip instead of deflate compression
+  void setCompression(int level, int chunk = 0, bool szip = false);
+
   //! \brief Returns the last time level stored in the HDF5 file.
   virtual int getLastTimeLevel();
 
@@ -52,6 +82,10 @@ public:
   //! \param[in] force If \e true, close even if \a keepopen was \e true
   virtual void closeFile(int level, bool force = false);
 
+  //! \brief Returns the compression statistics of the written time levels,
+  //! and clears them.
+  virtual std::string takeMessages();
+
   //! \brief Writes a vector to file.
   //! \param[in] level The time level to write the vector at
   //! \param[in] entry The DataEntry describing the vector
@@ -148,8 +182,53 @@ protected:
   //! \param[in] len The length of the array
   //! \param[in] data The array to write
   //! \param[in] type The HDF5 type for the data (see H5T)
+  //! \param[in] compress Compression level (-1 = use the default level)
   void writeArray(int group, const std::string& name,
-                  int len, const void* data, int type);
+                  int len, const void* data, int type, int compress = -1);
+
+  //! \brief Internal helper function. Creates a dataset in the HDF5 file.
+  //! \param[in] group The HDF5 group to create the dataset in
+  //! \param[in] name The name of the dataset
+  //! \param[in] siz The total length of the dataset
+  //! \param[in] type The HDF5 type for the data (see H5T)
+  //! \param level Compression level, reset to 0 if the dataset is uncompressed
+  //! \return The HDF5 handle of the dataset
+  int createDataset(int group, const std::string& name,
+                    size_t siz, int type, int& level);
+
+#ifdef HAVE_MPI
+  //! \brief Writes all queued datasets of the current time level.
+  //! \details The array lengths of all processes are exchanged in a single
+  //! collective call, and the data is written with collective transfers.
+  void flushArrays();
+  //! \brief Writes the queued datasets if the queue has grown too large.
+  //! \details This is a collective call. The largest queue over all processes
+  //! is compared with the bound, such that all processes flush together.
+  //! It is invoked once per field, not per patch, such that the bound may be
+  //! exceeded by the size of one field.
+  void checkPending();
+#endif
+
+  //! \brief A result field evaluated at the visualization points of a patch.
+  struct XdmfField;
+
+  //! \brief Internal helper function. Writes tesselated patch results to file.
+  //! \param[in] group The HDF5 group of the patch at current time level
+  //! \param[in] level The time level to write the results at
+  //! \param[in] patch 1-based global patch index
+  //! \param[in] basis The name of the basis of the SIM
+  //! \param[in] newGeom If \e true, write the tesselated grid of the patch
+  //! \param[in] pch The patch to tesselate, null if not owned by this process
+  //! \param[in] nViz Number of visualization points over each knot-span
+  //! \param[in] fields The result fields to write
+  void writeXdmfPatch(int group, int level, int patch,
+                      const std::string& basis, bool newGeom,
+                      const ASMbase* pch, const int* nViz,
+                      const std::vector<XdmfField>& fields);
+
+  //! \brief Internal helper function. Writes the XDMF index file.
+  //! \param[in] level The time level that was just written
+  void writeXdmf(int level);
 
   //! \brief Internal helper function. Writes a SIM's basis (geometry) to file.
   //! \param[in] SIM The SIM we want to write basis for
@@ -184,8 +263,49 @@ private:
   int          m_file; //!< The HDF5 handle for our file
   unsigned int m_flag; //!< The file flags to open HDF5 file with
   bool     m_keepOpen; //!< If \e true, we always keep the file open
+
+  int  m_compress; //!< Default compression level of the datasets
+  int  m_chunk;    //!< Chunk size of the datasets (0 = automatic)
+  bool m_szip;     //!< If \e true, use szip instead of deflate compression
+
+  size_t m_rawBytes;    //!< Uncompressed size of compressed datasets written
+  size_t m_storedBytes; //!< Stored size of compressed datasets written
+  double m_writeTime;   //!< Wall time spent in writing datasets
+  std::string m_messages; //!< Compression statistics not yet printed
+
+  //! \brief A tesselated patch grid referenced by the XDMF index file.
+  struct XdmfGrid
+  {
+    int    level;   //!< The time level the grid is stored at
+    size_t nPoints; //!< Number of visualization points
+    size_t nElms;   //!< Number of visualization elements
+    size_t nen;     //!< Number of nodes per visualization element
+  };
+
+  bool m_xdmf;       //!< If \e true, write tesselated results and XDMF index
+  bool m_xdmfActive; //!< If \e true, tesselated results were written at level
+  std::set<std::string>           m_xdmfBases; //!< Bases with written grids
+  std::map<std::string,XdmfGrid>  m_xdmfGrids; //!< Grids of the owned patches
+  std::string                     m_xdmfText;  //!< XDMF grids of current level
+  std::map<int,std::string>       m_xdmfLevels; //!< XDMF grids of each level
+  std::map<int,double>            m_xdmfTimes;  //!< Physical time of each level
 #ifdef HAVE_MPI
   const ProcessAdm& m_adm;   //!< Pointer to process adm in use
+
+  //! \brief A dataset queued for collective writing.
+  struct PendingArray
+  {
+    std::string group;      //!< Path of the HDF5 group to write into
+    std::string name;       //!< Name of the dataset
+    int         len;        //!< Number of values on this process
+    int         type;       //!< HDF5 type of the data
+    int         compress;   //!< Compression level (-1 = use the default level)
+    std::vector<char> data; //!< Copy of the data to write
+  };
+
+  std::vector<PendingArray> m_pending; //!< Queued datasets of current level
+  size_t m_pendingBytes; //!< Size of the data in the queued datasets
+  int m_aggr; //!< Number of I/O aggregators (0 = MPI-IO default)
 #endif
 };
 
@@ -0,0 +1,137 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LoadBalance.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Thread load-balance and element cost recording for assembly loops.
+//!
+//==============================================================================
+
+#ifndef _LOAD_BALANCE_H
+#define _LOAD_BALANCE_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+class ThreadGroups;
+namespace utl { class LogStream; }
+
+
+/*!
+  \brief Class for recording the thread load balance of an integration loop.
+
+  \details An object of this class is created before the loop over the
+  thread groups of a patch. Each thread measures the time spent on its element
+  strip through a LoadBalance::Strip object, and the cost of each element
+  through a LoadBalance::Element object. When the loop is finished, the
+  recorded timings are added to a summary which is printed (and reset) after
+  each assembly by the report() method.
+
+  All recording is void unless it has been enabled by the enable() method.
+*/
+
+class LoadBalance
+{
+  //! \brief Element cost and global element number.
+  typedef std::pair<double,int> ElmCost;
+
+  //! \brief Timings for one thread strip.
+  struct StripData
+  {
+    double start; //!< Start time of the strip
+    double stop;  //!< Stop time of the strip
+    size_t nSkip; //!< Number of skipped (zero-area) elements
+    std::vector<ElmCost> costs; //!< Cost of each element in the strip
+    //! \brief Default constructor.
+    StripData() : start(0.0), stop(0.0), nSkip(0) {}
+  };
+
+public:
+  class Element;
+
+  /*!
+    \brief Helper recording the busy time of a thread strip.
+  */
+
+  class Strip
+  {
+  public:
+    //! \brief The constructor starts the timing of a strip.
+    //! \param lb The integration loop recorder
+    //! \param[in] g Thread group index
+    //! \param[in] t Thread strip index within the group
+    Strip(LoadBalance& lb, size_t g, size_t t);
+    //! \brief The destructor stops the timing of the strip.
+    ~Strip();
+
+    //! \brief Records a skipped (zero-area) element.
+    void skip() { if (data) ++data->nSkip; }
+
+  private:
+    StripData* data; //!< Timings of this strip (null if disabled)
+
+    friend class Element;
+  };
+
+  /*!
+    \brief Helper recording the cost of an element.
+  */
+
+  class Element
+  {
+  public:
+    //! \brief The constructor starts the timing of an element.
+    //! \param strip The thread strip containing the element
+    //! \param[in] iel Global element number
+    Element(Strip& strip, int iel) : data(strip.data), elm(iel), start(0.0)
+    { if (data) start = LoadBalance::now(); }
+    //! \brief The destructor records the cost of the element.
+    ~Element()
+    {
+      if (data)
+        data->costs.push_back(ElmCost(LoadBalance::now()-start,elm));
+    }
+
+  private:
+    StripData* data;  //!< Timings of the strip (null if disabled)
+    int        elm;   //!< Global element number
+    double     start; //!< Start time of the element
+  };
+
+  //! \brief The constructor initializes the recording of an integration loop.
+  //! \param[in] patch One-based index of the patch being integrated
+  //! \param[in] groups Thread groups of the integration loop
+  LoadBalance(size_t patch, const ThreadGroups& groups);
+  //! \brief The destructor adds the recorded timings to the summary.
+  ~LoadBalance();
+
+  //! \brief Enables the load-balance recording.
+  //! \param[in] nTop Number of most expensive elements to report for each
+  //! patch, zero disables the recording
+  static void enable(size_t nTop);
+  //! \brief Returns \e true if the load-balance recording is enabled.
+  static bool enabled() { return topK > 0; }
+  //! \brief Returns the number of most expensive elements to report.
+  static size_t getTop() { return topK; }
+
+  //! \brief Prints a summary of the integration loops recorded since last
+  //! time, and resets the summary.
+  //! \param os The output stream to print to
+  static void report(utl::LogStream& os);
+
+private:
+  //! \brief Returns the current time, in seconds.
+  static double now();
+
+  size_t patchId; //!< One-based patch index
+  std::vector< std::vector<StripData> > strips; //!< Timings of all strips
+
+  static size_t topK; //!< Number of most expensive elements to report
+};
+
+#endif
@@ -18,7 +18,9 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <ctime>
+#include <cstdint>
 
 
 /*!
@@ -29,13 +31,47 @@
   arbitrary number of times, and the average time consumption is then also
   recorded along with the number of invokations.
 
+  The tasks are identified by integer IDs, which are interned once for each
+  profiling point (see the PROFILE macro), such that no string operations are
+  needed when starting and stopping a timer. Each thread accumulates its
+  timings into its own call tree, without any locking. The CPU time is
+  measured only for tasks registered with \a cpuTime set, since it usually
+  requires a system call.
+  On x86-64, the wall time is measured in time stamp counter ticks, which
+  are converted to seconds using the elapsed time of the profiler itself.
+
   The profiling results are printed in a nicely formatted table when the
-  profiler object goes out of scope, typically at the end of the program.
+  profiler object goes out of scope, typically at the end of the program,
+  followed by the call tree of the main thread.
+
+  Optionally, each begin/end of a task can also be recorded as a trace event,
+  see enableTrace(). The events are stored in a bounded ring buffer for each
+  thread, and are written to a Chrome trace file (which can be viewed in
+  chrome://tracing or Perfetto) when the profiler goes out of scope.
+
+  On Linux, hardware performance counters (cycles, instructions, last-level
+  cache misses and floating-point operations, where available) can also be
+  sampled for the tasks with CPU time measurement, see enableCounters().
+  The counters only measure the thread that starts and stops the task.
+  Tasks that used more CPU time than wall time, i.e., that ran multi-threaded,
+  are therefore flagged in the counter report.
+
+  The memory usage can also be reported for each task, see enableMemory().
+  The resident set size and its high-water mark are then sampled when tasks
+  with CPU time measurement are started and stopped. In addition, the large
+  data structures account for the memory they own through utl::MemAccount
+  objects, such that the report tells which of them that raised the peak.
 */
 
 class Profiler
 {
 public:
+  //! \brief Counters attached as arguments to the trace events.
+  enum TraceCounter { STEP = 0, ITERATION = 1, NCOUNTERS = 2 };
+  //! \brief Hardware performance counters sampled for each task.
+  enum HWCounter { CYCLES = 0, INSTRUCTIONS = 1, LLC_MISSES = 2, FLOPS = 3,
+                   NHW = 4 };
+
   //! \brief The constructor initializes the profiler object.
   //! \param[in] name Program name to be printed in the profiling report header.
   //!
@@ -46,53 +82,184 @@ public:
   //! \brief The destructor prints the profiling report to the console.
   ~Profiler();
 
-  //! \brief Starts profiling of task \a funcName and increments \a nRunners.
+  //! \brief Returns the unique ID of task \a funcName, registering it if new.
+  //! \param[in] funcName Name of the task
+  //! \param[in] cpuTime If \e false, only the wall time of the task is measured
+  static size_t getTimerId(const char* funcName, bool cpuTime = true);
+
+  //! \brief Starts profiling of the task with the given ID.
+  void start(size_t id);
+  //! \brief Stops profiling of the task with the given ID.
+  void stop(size_t id);
+
+  //! \brief Starts profiling of task \a funcName.
   void start(const std::string& funcName);
-  //! \brief Stops profiling of task \a funcName and decrements \a nRunners.
+  //! \brief Stops profiling of task \a funcName.
   void stop(const std::string& funcName);
 
   //! \brief Prints a profiling report for all tasks that have been measured.
   void report(std::ostream& os) const;
   //! \brief Clears the profiler.
-  void clear() { myTimers.clear(); allCPU = allWall = 0.0; nRunners = 0; }
+  //! \details The currently running tasks are kept, such that they still can
+  //! be stopped, but their timings are restarted.
+  //! \note No other thread should be profiling when this is invoked.
+  void clear();
+
+  //! \brief Enables writing of a machine-readable profiling report.
+  //! \param[in] fileName Name of the report file, written on destruction
+  //!
+  //! \details The report lists the tasks of the main thread with one
+  //! tab-separated line for each task, containing the task name, the number
+  //! of invokations, and the CPU and wall time in seconds. Comment lines start
+  //! with a \a #. If there is more than one MPI process, the process rank is
+  //! appended to the file name.
+  static void enableReport(const std::string& fileName);
+  //! \brief Writes the machine-readable profiling report to the given stream.
+  void writeReport(std::ostream& os) const;
+
+  //! \brief Enables recording of trace events.
+  //! \param[in] fileName Name of the Chrome trace file to write
+  //! \param[in] nEvents Size of the event ring buffer of each thread
+  //!
+  //! \details This may be invoked before or after the profiler is created.
+  //! If there is more than one MPI process, the process rank is appended
+  //! to the file name.
+  static void enableTrace(const std::string& fileName, size_t nEvents);
+  //! \brief Updates a counter that is attached to the following trace events.
+  static void setCounter(TraceCounter counter, int value);
+  //! \brief Writes the recorded trace events to the given stream.
+  void writeTrace(std::ostream& os) const;
+
+  //! \brief Enables sampling of hardware performance counters.
+  //! \return \e false if the counters are not available, e.g., due to the
+  //! perf_event_paranoid setting or the seccomp profile of a container
+  static bool enableCounters();
+  //! \brief Adds matrix non-zeros processed by the current task.
+  //! \details This is used to report the memory traffic per non-zero.
+  static void addNonZeros(size_t nnz);
+
+  //! \brief Enables sampling of the memory usage of each task.
+  static void enableMemory();
+  //! \brief Returns the unique ID of memory account \a owner.
+  static size_t getMemoryId(const char* owner);
+  //! \brief Adds (or subtracts) a number of bytes to a memory account.
+  static void addBytes(size_t account, int64_t nBytes);
+
+  //! \brief Returns the number of invokations of a task in the call tree.
+  //! \param[in] path Task names separated by '/', relative to the current task
+  //! of the calling thread
+  size_t getNoCalls(const std::string& path) const;
+  //! \brief Returns the wall time and number of calls of the main thread tasks.
+  //! \details Only completed invokations contribute to the wall time, such
+  //! that this may be invoked while tasks are running, e.g., for progress
+  //! reports.
+  std::map< std::string,std::pair<double,size_t> > getTaskTimes() const;
 
 private:
   //! \brief Stores profiling data for one computational task.
   struct Profile
   {
-    clock_t startCPU;  //!< The last starting CPU time of this task
-    double  startWall; //!< The last starting wall clock time of this task
-    double  totalCPU;  //!< Total CPU time consumed by this task so far
-    double  totalWall; //!< Total wall clock time consumed by this task so far
-    size_t  nCalls;    //!< Number of invokations of this task
-    bool    running;   //!< Flag indicating if this task is currently running
+    clock_t  startCPU;   //!< The last starting CPU time of this task
+    uint64_t startTick;  //!< The last starting clock tick of this task
+    uint64_t totalTicks; //!< Total clock ticks consumed by this task so far
+    int      startCount[NCOUNTERS]; //!< Trace counters when last started
+    double   startHW[NHW]; //!< Hardware counters when last started
+    double   totalHW[NHW]; //!< Hardware counts by this task so far
+    double   nnz;          //!< Matrix non-zeros processed by this task so far
+    size_t   startHWM;     //!< Resident set high-water mark when last started
+    size_t   startOwned;   //!< Accounted memory high-water mark when started
+    size_t   maxRSS;       //!< Largest resident set size when stopped
+    size_t   maxHWM;       //!< Largest high-water mark when stopped
+    size_t   incHWM;       //!< Resident set high-water mark increase
+    size_t   incOwned;     //!< Accounted memory high-water mark increase
+    double   totalCPU;   //!< Total CPU time consumed by this task so far
+    double   totalWall;  //!< Total wall clock time (only set when reporting)
+    size_t   nCalls;     //!< Number of invokations of this task
+    bool     running;    //!< Flag indicating if this task is currently running
+    bool     haveCPU;    //!< Flag indicating if the CPU time is measured
+    bool     haveHW;     //!< Flag indicating if hardware counters are sampled
+    bool     haveMem;    //!< Flag indicating if the memory usage is sampled
 
     //! \brief The constructor initializes the total times to zero.
-    Profile() : nCalls(0), running(false) { totalCPU = totalWall = 0.0; }
+    Profile(bool cpu = true) : totalTicks(0), nCalls(0), running(false),
+                               haveCPU(cpu), haveHW(false), haveMem(false)
+    {
+      totalCPU = totalWall = nnz = 0.0;
+      startHWM = startOwned = maxRSS = maxHWM = incHWM = incOwned = 0;
+      for (int& c : startCount) c = 0;
+      for (int i = 0; i < NHW; i++) startHW[i] = totalHW[i] = 0.0;
+    }
     //! \brief Checks if this profile item have any timing to report.
     bool haveTime() const { return totalCPU >= 0.005 || totalWall >= 0.005; }
+    //! \brief Adds the timings of another profile item to this one.
+    //! \param[in] p The profile item to add
+    //! \param[in] secPerTick Length of a clock tick in seconds
+    void add(const Profile& p, double secPerTick);
+  };
+
+  //! \brief A node in the call tree of a thread.
+  struct Node
+  {
+    size_t              id;       //!< The task ID
+    size_t              parent;   //!< Index of the parent node
+    std::vector<size_t> children; //!< Indices of the child nodes
+    Profile             prof;     //!< Accumulated timings of this node
+  };
+
+  //! \brief A recorded trace event.
+  struct Event
+  {
+    uint64_t start; //!< Clock tick when the event started
+    uint64_t ticks; //!< Duration of the event in clock ticks
+    size_t   id;    //!< Task ID, or counter index for counter events
+    int      count[NCOUNTERS]; //!< Trace counters when the event started
+    char     phase; //!< Chrome trace event type, 'X' (task) or 'C' (counter)
+  };
+
+  struct HWGroup;
+
+  //! \brief The call tree and the current task of one thread.
+  struct ThreadData
+  {
+    HWGroup*           hw;      //!< Hardware counters of this thread
+    std::vector<Node>  nodes;   //!< The call tree, the root node is a sentinel
+    size_t             current; //!< Index of the currently running node
+    std::vector<Event> events;  //!< Ring buffer of recorded trace events
+    size_t             nEvents; //!< Total number of events recorded
   };
 
   //! \brief Global stream operator printing a Profile instance.
   friend std::ostream& operator<<(std::ostream& os, const Profile& p);
 
-  std::string myName; //!< Name of this profiler
-
-  typedef std::map<std::string,Profile> ProfileMap; //!< Map of profilers
+  //! \brief Returns the call tree of the calling thread, creating it if new.
+  ThreadData* getThreadData();
+  //! \brief Records a trace event in the ring buffer of a thread.
+  static void record(ThreadData* td, const Event& event);
+  //! \brief Reads the hardware counters of a thread.
+  static bool readCounters(ThreadData* td, double* values);
+  //! \brief Accumulates the timings of a call tree by task name.
+  void sumTasks(const ThreadData& td, std::vector<Profile>& tasks) const;
+  //! \brief Prints the hardware counter derived metrics of all tasks.
+  void reportCounters(std::ostream& os,
+                      const std::vector< std::vector<Profile> >& tasks,
+                      const std::map<std::string,size_t>& names) const;
+  //! \brief Prints the memory usage of the main thread tasks and the owners.
+  void reportMemory(std::ostream& os, const std::vector<Profile>& tasks,
+                    const std::map<std::string,size_t>& names) const;
+  //! \brief Prints a call tree node and its children recursively.
+  void printTree(std::ostream& os, const ThreadData& td, size_t node,
+                 int depth, double secPerTick) const;
+  //! \brief Returns the length of a clock tick in seconds.
+  double secondsPerTick() const;
 
-  ProfileMap              myTimers;  //!< The task profiles with names
-  std::vector<ProfileMap> myMTimers; //!< Task profiles with names and thread iD
+  std::string myName; //!< Name of this profiler
 
-  double allCPU;  //!< Accumulated CPU time from all "main" tasks
-  double allWall; //!< Accumulated wall clock time of all "main" tasks
+  uint64_t myStartTick; //!< Clock tick when this profiler was created
+  double   myStartWall; //!< Wall time when this profiler was created
 
-  //! \details When \a nRunners is 1, we are only measuring the total time.
-  //! When \a nRunners is 2, we are also measuring a "main" task, which total
-  //! time is subtracted from the measured total time to find the reminder of
-  //! all tasks that are not being measured. When \a nRunners is 3 or larger,
-  //! the measured task is already included in another "main" task,
-  //! and therefore its time is not included when calculating the "other" times.
-  size_t nRunners; //!< Number of tasks currently running
+  mutable std::mutex       myMutex;   //!< Protects the thread list
+  std::vector<ThreadData*> myThreads; //!< Call trees, the main thread first
+  unsigned int             myGen;     //!< Generation number of this profiler
 };
 
 
@@ -100,21 +267,74 @@ namespace utl
 {
   extern Profiler* profiler; //!< Pointer to the one and only profiler object.
 
+  //! \brief Returns the current wall time in seconds.
+  //! \details The resolution is in microseconds.
+  double getWallTime();
+  //! \brief Returns the current resident set size of the process in bytes.
+  size_t getResidentSize();
+  //! \brief Returns the high-water mark of the resident set size in bytes.
+  size_t getHighWaterMark();
+
   //! \brief Convenience class to profile the local scope.
   class prof
   {
-    const char* name; //!< Name tag on the local scope to profile
+    size_t id; //!< ID of the task to profile
   public:
+    //! \brief The constructor starts the profiling of the identified task.
+    prof(size_t tID) : id(tID) { if (profiler) profiler->start(id); }
     //! \brief The constructor starts the profiling of the named task.
-    prof(const char* tag) : name(tag) { if (profiler) profiler->start(name); }
+    prof(const char* tag) : id(Profiler::getTimerId(tag))
+    { if (profiler) profiler->start(id); }
     //! \brief The destructor stops the profiling.
-    ~prof() { if (profiler) profiler->stop(name); }
+    ~prof() { if (profiler) profiler->stop(id); }
+  };
+
+  //! \brief Convenience class for accounting of memory owned by an object.
+  //! \details The bytes are added to a named account in the memory report
+  //! of the profiler, and are subtracted again when this object is destroyed.
+  class MemAccount
+  {
+    size_t id;    //!< ID of the memory account
+    size_t bytes; //!< Number of bytes currently accounted
+  public:
+    //! \brief The constructor accounts an initial number of bytes.
+    //! \param[in] owner Name of the memory account
+    //! \param[in] nBytes Number of bytes owned
+    MemAccount(const char* owner, size_t nBytes = 0)
+      : id(Profiler::getMemoryId(owner)), bytes(0) { this->set(nBytes); }
+    //! \brief The copy constructor accounts the same bytes once more.
+    MemAccount(const MemAccount& a) : id(a.id), bytes(0) { this->set(a.bytes); }
+    //! \brief The destructor subtracts the accounted bytes.
+    ~MemAccount() { this->set(0); }
+    //! \brief Assignment operator.
+    MemAccount& operator=(const MemAccount& a)
+    {
+      this->set(a.bytes);
+      return *this;
+    }
+
+    //! \brief Updates the number of bytes owned.
+    void set(size_t nBytes)
+    {
+      if (nBytes != bytes)
+        Profiler::addBytes(id,int64_t(nBytes)-int64_t(bytes));
+      bytes = nBytes;
+    }
   };
 }
 
 
 //! \brief Macro to add profiling of the local scope.
-#define PROFILE(label) utl::prof _prof(label)
+//! \details The task ID is interned only once for each profiling point.
+#define PROFILE(label) \
+  static const size_t _prof_id = Profiler::getTimerId(label); \
+  utl::prof _prof(_prof_id)
+
+//! \brief Macro to add wall time profiling of the local scope.
+//! \details This is used for the fine-grained profiling levels.
+#define PROFILE_WALL(label) \
+  static const size_t _prof_id = Profiler::getTimerId(label,false); \
+  utl::prof _prof(_prof_id)
 
 #if PROFILE_LEVEL >= 1
 #define PROFILE1(label) PROFILE(label)
@@ -131,14 +351,14 @@ namespace utl
 #endif
 
 #if PROFILE_LEVEL >= 3
-#define PROFILE3(label) PROFILE(label)
+#define PROFILE3(label) PROFILE_WALL(label)
 #else
 //! \brief Macro to add level 3 profiling of the local scope.
 #define PROFILE3(label)
 #endif
 
 #if PROFILE_LEVEL >= 4
-#define PROFILE4(label) PROFILE(label)
+#define PROFILE4(label) PROFILE_WALL(label)
 #else
 //! \brief Macro to add level 4 profiling of the local scope.
 #define PROFILE4(label)
@@ -0,0 +1,80 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ScalingStudy.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Thread scaling study of the computational phases of a simulator.
+//!
+//==============================================================================
+
+#ifndef _SCALING_STUDY_H
+#define _SCALING_STUDY_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace utl { class LogStream; }
+
+
+/*!
+  \brief Class for collecting and reporting the timings of a scaling study.
+
+  \details The wall times of each phase are recorded for a list of thread
+  counts, keeping the fastest of repeated runs. The report gives the speedup
+  and the parallel efficiency relative to the first thread count in the list,
+  and the experimentally determined serial fraction (Karp-Flatt metric)
+  \f[ f = \frac{1/S - 1/p}{1 - 1/p} \f]
+  where \a S is the speedup and \a p is the ratio between the thread counts.
+  A serial fraction that increases with the thread count indicates parallel
+  overhead rather than a serial part of the algorithm.
+*/
+
+class ScalingStudy
+{
+public:
+  //! \brief The constructor initializes the list of thread counts.
+  //! \param[in] nThreads Thread counts to study, the first one is the reference
+  explicit ScalingStudy(const std::vector<int>& nThreads) : threads(nThreads) {}
+
+  //! \brief Returns the thread counts of the study.
+  const std::vector<int>& getThreads() const { return threads; }
+
+  //! \brief Records the wall time of a phase.
+  //! \param[in] phase Name of the computational phase
+  //! \param[in] idx Index of the thread count of the run
+  //! \param[in] wallTime Wall time of the run, in seconds
+  //!
+  //! \details If the phase already has a time for this thread count,
+  //! the smallest of the two is kept.
+  void add(const std::string& phase, size_t idx, double wallTime);
+
+  //! \brief Returns the recorded wall time of a phase.
+  //! \param[in] phase Name of the computational phase
+  //! \param[in] idx Index of the thread count
+  //! \return Negative value if no time is recorded
+  double getTime(const std::string& phase, size_t idx) const;
+
+  //! \brief Prints the speedup, efficiency and serial fraction of each phase.
+  //! \param os The output stream to print to
+  //! \param[in] nProc Number of MPI processes of the study
+  //! \param[in] nRepeat Number of repeated runs for each thread count
+  void report(utl::LogStream& os, int nProc = 1, int nRepeat = 1) const;
+
+  //! \brief Sets the number of threads of the parallel regions.
+  //! \return The previous number of threads
+  static int setThreads(int nThreads);
+
+private:
+  //! \brief Wall times of a phase, indexed by thread count.
+  typedef std::pair< std::string,std::vector<double> > Phase;
+
+  std::vector<int>   threads; //!< Thread counts of the study
+  std::vector<Phase> phases;  //!< Wall times of each phase, in given order
+};
+
+#endif
@@ -0,0 +1,133 @@
+// $Id$
+//==============================================================================
+//!
+//! \file Telemetry.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author IFEM developers / SINTEF
+//!
+//! \brief Machine-readable stream of solver and time step records.
+//!
+//==============================================================================
+
+#ifndef _TELEMETRY_H
+#define _TELEMETRY_H
+
+#include <string>
+
+
+/*!
+  \brief Class for writing solver telemetry as JSON lines.
+
+  \details The telemetry consists of one JSON object per line, each having a
+  \a type and a \a wall (seconds since the telemetry was opened) member,
+  followed by the record-specific members, e.g.
+  \code
+  {"type":"iteration","wall":1.53,"step":2,"time":0.2,"iter":1,"conv":1e-3}
+  \endcode
+
+  The records are buffered in memory and written when the buffer is full,
+  and after each time step record. The sink may be a regular file or a named
+  pipe. When writing to a pipe, records are dropped rather than blocking the
+  simulation if no reader is attached.
+
+  All methods are no-ops (except for a single test) unless the telemetry
+  has been opened by the open() method.
+*/
+
+class Telemetry
+{
+public:
+  //! \brief Wall time accumulators, reported (and reset) by each step record.
+  enum Timer { ASSEMBLY, SOLVE, OUTPUT, NTIMERS };
+
+  /*!
+    \brief Builder of a telemetry record.
+    \details The record is completed and added to the stream buffer when
+    the object goes out of scope. The intended usage is as a temporary, e.g.
+    \code
+    if (Telemetry::enabled())
+      Telemetry::Record("iteration").add("iter",iter).add("conv",conv);
+    \endcode
+  */
+
+  class Record
+  {
+  public:
+    //! \brief The constructor starts a record of the given type.
+    explicit Record(const char* type);
+    //! \brief The destructor completes the record and adds it to the stream.
+    ~Record();
+
+    //! \brief Adds an integer-valued member to the record.
+    Record& add(const char* key, long long value);
+    //! \brief Adds an integer-valued member to the record.
+    Record& add(const char* key, int value)
+    { return this->add(key,(long long)value); }
+    //! \brief Adds an unsigned integer-valued member to the record.
+    Record& add(const char* key, size_t value)
+    { return this->add(key,(long long)value); }
+    //! \brief Adds a real-valued member to the record.
+    Record& add(const char* key, double value);
+    //! \brief Adds a string-valued member to the record.
+    Record& add(const char* key, const char* value);
+    //! \brief Adds a boolean member to the record.
+    Record& add(const char* key, bool value);
+
+  private:
+    std::string line; //!< The JSON-formatted record
+  };
+
+  /*!
+    \brief Helper accumulating the wall time of the local scope.
+  */
+
+  class Scope
+  {
+  public:
+    //! \brief The constructor starts the timing.
+    explicit Scope(Timer t) : timer(t), start(enabled() ? now() : -1.0) {}
+    //! \brief The destructor adds the elapsed time to the accumulator.
+    ~Scope() { if (start >= 0.0) addTime(timer,now()-start); }
+
+  private:
+    Timer  timer; //!< The accumulator to add the elapsed time to
+    double start; //!< Start time (negative if disabled)
+  };
+
+  //! \brief Opens the telemetry sink.
+  //! \param[in] fileName Name of the output file or named pipe
+  //! \param[in] bufSize Size of the output buffer in bytes
+  //!
+  //! \details In parallel simulations, only the first process writes.
+  static bool open(const std::string& fileName, size_t bufSize = 65536);
+  //! \brief Flushes the buffered records and closes the sink.
+  static void close();
+  //! \brief Returns \e true if the telemetry sink is open and not suspended.
+  static bool enabled() { return active && !suspended; }
+  //! \brief Suspends or resumes the recording.
+  //! \return The previous suspension state
+  static bool suspend(bool on)
+  { bool old = suspended; suspended = on; return old; }
+  //! \brief Writes the buffered records to the sink.
+  static void flush();
+
+  //! \brief Adds elapsed wall time to the given accumulator.
+  static void addTime(Timer timer, double seconds);
+  //! \brief Returns the accumulated wall time, and resets the accumulator.
+  static double takeTime(Timer timer);
+  //! \brief Adds to the number of linear solver iterations.
+  static void addLinearIterations(int nIts);
+  //! \brief Returns the number of linear solver iterations, and resets it.
+  static int takeLinearIterations();
+
+  //! \brief Returns the time in seconds since the telemetry was opened.
+  static double now();
+
+private:
+  static bool active;    //!< If \e true, the telemetry sink is open
+  static bool suspended; //!< If \e true, nothing is recorded
+};
+
+#endif